@@ -6,12 +6,17 @@
 #define MICRAS_CONSTANTS_HPP
 
 #include <cstdint>
+#include <numbers>
 
 #include "micras/nav/action_queuer.hpp"
+#include "micras/nav/correction_log.hpp"
+#include "micras/nav/feed_forward_estimator.hpp"
 #include "micras/nav/follow_wall.hpp"
 #include "micras/nav/maze.hpp"
 #include "micras/nav/odometry.hpp"
+#include "micras/nav/route_time_estimator.hpp"
 #include "micras/nav/speed_controller.hpp"
+#include "micras/nav/tracking_controller.hpp"
 
 namespace micras {
 /*****************************************
@@ -25,9 +30,21 @@ constexpr uint32_t loop_time_us{1042};
 constexpr float    wall_thickness{0.0126F};
 constexpr float    start_offset{0.04F + wall_thickness / 2.0F};
 constexpr float    exploration_speed{0.5F};
+constexpr float    solving_speed{1.0F};
 constexpr float    max_linear_acceleration{1.0F};
+constexpr float    max_linear_jerk{25.0F};
 constexpr float    max_angular_acceleration{200.0F};
 constexpr float    crash_acceleration{20.0F};
+constexpr float    front_wall_deviation{0.002F};
+constexpr float    post_deviation{0.004F};
+constexpr float    post_detection_offset{0.03F};
+constexpr float    max_advance_correction{cell_size / 4.0F};
+constexpr float    wall_lateral_deviation{0.002F};
+constexpr float    wall_heading_deviation{0.02F};
+constexpr float    turn_ramp_ratio{0.25F};
+constexpr float    distance_sweep_speed{0.1F};
+constexpr float    distance_sweep_length{cell_size};
+constexpr float    distance_sweep_step{0.005F};
 
 constexpr core::WallSensorsIndex wall_sensors_index{
     .left_front = 0,
@@ -42,6 +59,7 @@ constexpr core::WallSensorsIndex wall_sensors_index{
 
 namespace nav {
 using Maze = TMaze<maze_width, maze_height>;
+using CorrectionLog = TCorrectionLog<64>;
 }  // namespace nav
 
 /*****************************************
@@ -56,25 +74,118 @@ const nav::ActionQueuer::Config action_queuer_config{
             .max_linear_speed = exploration_speed,
             .max_linear_acceleration = max_linear_acceleration,
             .max_linear_deceleration = max_linear_acceleration,
+            .max_linear_jerk = max_linear_jerk,
             .curve_radius = cell_size / 2.0F,
             .max_centrifugal_acceleration = 2.78F,
             .max_angular_acceleration = max_angular_acceleration,
         },
     .solving =
         {
-            .max_linear_speed = exploration_speed,
+            .max_linear_speed = solving_speed,
             .max_linear_acceleration = max_linear_acceleration,
             .max_linear_deceleration = max_linear_acceleration,
+            .max_linear_jerk = max_linear_jerk,
             .curve_radius = cell_size / 2.0F,
-            .max_centrifugal_acceleration = 1.0F,
+            .max_centrifugal_acceleration = 2.78F,
             .max_angular_acceleration = max_angular_acceleration,
         },
+    .turns =
+        {
+            .search_90 =
+                {
+                    .angle = std::numbers::pi_v<float> / 2.0F,
+                    .ramp_ratio = turn_ramp_ratio,
+                    .displacement = {cell_size / 2.0F, cell_size / 2.0F},
+                },
+            .large_90 =
+                {
+                    .angle = std::numbers::pi_v<float> / 2.0F,
+                    .ramp_ratio = turn_ramp_ratio,
+                    .displacement = {cell_size, cell_size},
+                },
+            .u_turn_180 =
+                {
+                    .angle = std::numbers::pi_v<float>,
+                    .ramp_ratio = turn_ramp_ratio,
+                    .displacement = {0.0F, cell_size},
+                },
+            .in_45 =
+                {
+                    .angle = std::numbers::pi_v<float> / 4.0F,
+                    .ramp_ratio = turn_ramp_ratio,
+                    .displacement = {cell_size, cell_size / 2.0F},
+                },
+            .out_45 =
+                {
+                    .angle = std::numbers::pi_v<float> / 4.0F,
+                    .ramp_ratio = turn_ramp_ratio,
+                    .displacement =
+                        {3.0F * std::numbers::sqrt2_v<float> * cell_size / 4.0F,
+                         std::numbers::sqrt2_v<float> * cell_size / 4.0F},
+                },
+            .in_135 =
+                {
+                    .angle = 3.0F * std::numbers::pi_v<float> / 4.0F,
+                    .ramp_ratio = turn_ramp_ratio,
+                    .displacement = {cell_size / 2.0F, cell_size},
+                },
+            .out_135 =
+                {
+                    .angle = 3.0F * std::numbers::pi_v<float> / 4.0F,
+                    .ramp_ratio = turn_ramp_ratio,
+                    .displacement =
+                        {std::numbers::sqrt2_v<float> * cell_size / 4.0F,
+                         3.0F * std::numbers::sqrt2_v<float> * cell_size / 4.0F},
+                },
+            .v_90 =
+                {
+                    .angle = std::numbers::pi_v<float> / 2.0F,
+                    .ramp_ratio = turn_ramp_ratio,
+                    .displacement =
+                        {std::numbers::sqrt2_v<float> * cell_size / 2.0F,
+                         std::numbers::sqrt2_v<float> * cell_size / 2.0F},
+                },
+        },
+    .turn_back =
+        {
+            .max_angular_speed = 0.01F * max_angular_acceleration,
+            .overlap_speed = 0.15F,
+            .launch_angle = 0.3F,
+        },
+};
+
+const nav::FeedForwardEstimator::Config feed_forward_estimator_config{
+    .estimator =
+        {
+            .forgetting_factor = 0.9995F,
+            .initial_covariance = 10.0F,
+            .max_covariance_trace = 40.0F,
+        },
+    .filter = {core::FilterDesign::LOW_PASS, 10.0F, 1e6F / loop_time_us},
+    .min_linear_speed = 0.1F,
+    .min_angular_speed = 1.0F,
+    .max_command = 100.0F,
+    .min_num_of_samples = 1000,
+    .min_gains =
+        {
+            .linear_speed = 5.0F,
+            .linear_acceleration = 0.5F,
+            .angular_speed = -3.0F,
+            .angular_acceleration = -0.2F,
+        },
+    .max_gains =
+        {
+            .linear_speed = 25.0F,
+            .linear_acceleration = 8.0F,
+            .angular_speed = 3.0F,
+            .angular_acceleration = 0.2F,
+        },
 };
 
 const nav::FollowWall::Config follow_wall_config{
     .pid =
         {
-            .kp = 0.5F,
+            .kp = 10.0F,
             .ki = 0.0F,
             .kd = 0.0F,
             .setpoint = 0.0F,
@@ -85,6 +196,8 @@ const nav::FollowWall::Config follow_wall_config{
     .post_threshold = 16.5F,
     .cell_size = cell_size,
     .post_clearance = 0.2F * cell_size,
+    .heading_window = 0.02F,
+    .heading_lookahead = 0.2F,
 };
 
 const nav::Maze::Config maze_config{
@@ -99,11 +212,51 @@ const nav::Maze::Config maze_config{
 };
 
 const nav::Odometry::Config odometry_config{
+    .pose_estimator = nav::Odometry::PoseEstimator::DEAD_RECKONING,
+    .linear_estimator = nav::Odometry::LinearEstimator::OBSERVER,
     .linear_cutoff_frequency = 5.0F,
+    .linear_observer =
+        {
+            .process_noise = 1.0F,
+            .measurement_noise = 0.0001F,
+        },
+    .wheel_velocity =
+        {
+            .min_blend_velocity = 20.0F,
+            .max_blend_velocity = 40.0F,
+        },
+    .kalman_filter =
+        {
+            .linear_acceleration_noise = 2.0F,
+            .angular_acceleration_noise = 200.0F,
+            .gyro_bias_drift = 0.001F,
+            .encoder_noise = 0.02F,
+            .gyro_noise = 0.002F,
+            .initial_gyro_bias_deviation = 0.01F,
+        },
+    .position_deviation = 0.004F,
+    .orientation_deviation = 0.01F,
+    .gyro_bias =
+        {
+            .max_acceleration_variance = 0.05F,
+            .max_wheel_displacement = 0.005F,
+            .min_stationary_time = 0.2F,
+            .acceleration_time_constant = 0.05F,
+            .bias_time_constant = 5.0F,
+            .gyro_noise = 0.005F,
+            .initial_bias_deviation = 0.05F,
+            .reference_temperature = 25.0F,
+            .temperature_coefficient = 0.0F,
+            .temperature_coefficient_deviation = 0.0005F,
+        },
     .wheel_radius = 0.0112F,
     .initial_pose = {{0.0F, 0.0F}, 0.0F},
 };
 
+const nav::RouteTimeEstimator::Config route_time_estimator_config{
+    .sample_time = loop_time_us / 1e6F,
+};
+
 const nav::SpeedController::Config speed_controller_config{
     .max_linear_acceleration = max_linear_acceleration,
     .max_angular_acceleration = max_angular_acceleration,
@@ -112,18 +265,20 @@ const nav::SpeedController::Config speed_controller_config{
             .kp = 10.0F,
             .ki = 1.0F,
             .kd = 0.0F,
-            .setpoint = 0.0F,
+            .setpoint_weight = 1.0F,
+            .derivative_cutoff = 50.0F,
+            .tracking_gain = 1.0F,
             .saturation = 40.0F,
-            .max_integral = -1.0F,
         },
     .angular_pid =
         {
             .kp = 2.0F,
             .ki = 1.0F,
             .kd = 0.0F,
-            .setpoint = 0.0F,
+            .setpoint_weight = 1.0F,
+            .derivative_cutoff = 50.0F,
+            .tracking_gain = 1.0F,
             .saturation = 40.0F,
-            .max_integral = -1.0F,
         },
     .left_feed_forward =
         {
@@ -140,6 +295,12 @@ const nav::SpeedController::Config speed_controller_config{
             .angular_acceleration = -0.0244F,
         },
 };
+
+const nav::TrackingController::Config tracking_controller_config{
+    .along_gain = 10.0F,
+    .lateral_gain = 100.0F,
+    .heading_gain = 20.0F,
+};
 }  // namespace micras
 
 #endif  // MICRAS_CONSTANTS_HPP
@@ -51,6 +51,11 @@ const proxy::Storage::Config maze_storage_config{
     .number_of_pages = 1,
 };
 
+const proxy::Storage::Config calibration_storage_config{
+    .start_page = 3,
+    .number_of_pages = 1,
+};
+
 /*****************************************
  * Interface
  *****************************************/
@@ -178,6 +183,8 @@ const proxy::RotarySensor::Config rotary_sensor_left_config = {
             .handle = &htim2,
             .timer_channel = TIM_CHANNEL_ALL,
         },
+    // No timer captures the encoder clock yet, so the edges are timed by the loop
+    .edge_capture = std::nullopt,
     .crc =
         {
             .handle = &hcrc,
@@ -204,6 +211,7 @@ const proxy::RotarySensor::Config rotary_sensor_right_config = {
             .handle = &htim5,
             .timer_channel = TIM_CHANNEL_ALL,
         },
+    .edge_capture = std::nullopt,
     .crc =
         {
             .handle = &hcrc,
@@ -221,7 +229,13 @@ const proxy::TorqueSensors::Config torque_sensors_config = {
         },
     .shunt_resistor = 0.04F * 20,
     .max_torque = 10.0F,
-    .filter_cutoff = 10.0F,
+    // Updated every loop
+    .filter =
+        {
+            .type = core::FilterDesign::LOW_PASS,
+            .cutoff_frequency = 15.0F,
+            .sampling_frequency = 960.0F,
+        },
 };
 
 const proxy::WallSensors::Config wall_sensors_config = {
@@ -243,7 +257,31 @@ const proxy::WallSensors::Config wall_sensors_config = {
             .handle = &htim15,
             .timer_channel = TIM_CHANNEL_2,
         },
-    .filter_cutoff = 5.0F,
+    .timer = stopwatch_config.timer,
+    // Each emitter period takes all the conversions, so a faster PWM would be needed to oversample
+    .oversampling = 1,
+    // Each slot lights a single front emitter, so the front sensors do not see each other in a front wall
+    .emitter_slots =
+        {{
+            {
+                .led_0_duty_cycle = 50.0F,
+                .led_1_duty_cycle = 0.0F,
+                .sensors = {true, false, true, false},
+            },
+            {
+                .led_0_duty_cycle = 0.0F,
+                .led_1_duty_cycle = 50.0F,
+                .sensors = {false, true, false, true},
+            },
+        }},
+    .num_of_slots = 2,
+    // Between the limits of the cutoff, the filters delay the readings by sqrt(2) / spatial_cutoff meters
+    .filter =
+        {
+            .min_cutoff = 50.0F,
+            .max_cutoff = 400.0F,
+            .spatial_cutoff = 300.0F,
+        },
     .base_readings =
         {
             0.413F,
@@ -251,6 +289,13 @@ const proxy::WallSensors::Config wall_sensors_config = {
             0.177F,
             0.230F,
         },
+    .base_distances =
+        {
+            0.0837F,
+            0.0837F,
+            0.0837F,
+            0.0837F,
+        },
     .uncertainty = 0.5F,
 };
 
@@ -272,7 +317,15 @@ const proxy::Imu::Config imu_config = {
     .gyroscope_scale = LSM6DSV_4000dps,
     .accelerometer_scale = LSM6DSV_8g,
     .gyroscope_filter = LSM6DSV_GY_ULTRA_LIGHT,
-    .accelerometer_filter = LSM6DSV_XL_MEDIUM
+    .accelerometer_filter = LSM6DSV_XL_MEDIUM,
+    .read_mode = proxy::Imu::ReadMode::REGISTERS,
+    .transfer_mode = proxy::Imu::TransferMode::BLOCKING,
+    .fifo =
+        {
+            .gyroscope_batch_rate = LSM6DSV_GY_BATCHED_AT_960Hz,
+            .accelerometer_batch_rate = LSM6DSV_XL_BATCHED_AT_960Hz,
+            .temperature_batch_rate = LSM6DSV_TEMP_BATCHED_AT_15Hz,
+        },
 };
 
 const proxy::Battery::Config battery_config = {
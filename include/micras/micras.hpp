@@ -46,6 +46,13 @@ public:
      */
     bool calibrate();
 
+    /**
+     * @brief Check if the robot is sweeping the front sensors to fit their distance tables.
+     *
+     * @return True if the distance sweep is running, false otherwise.
+     */
+    bool is_sweeping_distances() const;
+
     /**
      * @brief Prepare the robot for the next run.
      */
@@ -134,15 +141,51 @@ public:
      */
     void load_best_route();
 
+    /**
+     * @brief Save the calibrations, like the wall sensors distance tables and the feed-forward gains, to the
+     * non-volatile storage.
+     */
+    void save_calibration();
+
 private:
     /**
      * @brief Enum for the type of calibration being performed.
      */
     enum CalibrationType : uint8_t {
-        SIDE_WALLS = 0,  // Calibrate side walls and front free space detection.
-        FRONT_WALL = 1,  // Calibrate front wall detection.
+        SIDE_WALLS = 0,      // Calibrate side walls and front free space detection.
+        FRONT_WALL = 1,      // Calibrate front wall detection.
+        DISTANCE_TABLE = 2,  // Fit the front sensors distance tables backing away from the front wall.
     };
 
+    /**
+     * @brief Drive the robot back from the front wall, sampling the front sensors at each step of the sweep.
+     *
+     * @return True if the sweep is finished and the distance tables were fitted, false otherwise.
+     *
+     * @details The sweep starts at the front wall calibration point, so the distance to the wall is the base distance
+     * plus the distance travelled back, minus the lag of the filtered readings.
+     */
+    bool sweep_distance_tables();
+
+    /**
+     * @brief Correct the advance of the robot along the current action with a wall sensor measurement.
+     *
+     * @param source Source of the measurement.
+     * @param cell_advance Advance of the measured point after a cell edge in meters.
+     *
+     * @details The measured point repeats every cell, so the robot is moved to the closest one. Measurements too far
+     * from the estimate are discarded, as they are more likely a wrong detection than an odometry error.
+     */
+    void correct_advance(nav::CorrectionLog::Source source, float cell_advance);
+
+    /**
+     * @brief Correct the lateral position and the orientation of the robot with the side walls estimate.
+     *
+     * @details The odometry starts aligned with the maze, so the corridors are along multiples of a right angle and
+     * their centers repeat every cell from the cell where the robot started.
+     */
+    void correct_corridor_pose();
+
     /**
      * @brief Sensors and actuators.
      */
@@ -152,6 +195,7 @@ private:
     proxy::Locomotion locomotion{locomotion_config};
     proxy::Stopwatch  loop_stopwatch{stopwatch_config};
     proxy::Storage    maze_storage{maze_storage_config};
+    proxy::Storage    calibration_storage{calibration_storage_config};
     // proxy::TorqueSensors torque_sensors{torque_sensors_config};
     ///@}
 
@@ -180,11 +224,13 @@ private:
      * @brief High level objects.
      */
     ///@{
-    nav::ActionQueuer    action_queuer;
-    nav::Maze            maze;
-    nav::Odometry        odometry;
-    nav::SpeedController speed_controller;
-    nav::FollowWall      follow_wall;
+    nav::ActionQueuer         action_queuer;
+    nav::Maze                 maze;
+    nav::Odometry             odometry;
+    nav::SpeedController      speed_controller;
+    nav::FeedForwardEstimator feed_forward_estimator;
+    nav::TrackingController   tracking_controller;
+    nav::FollowWall           follow_wall;
     ///@}
 
     /**
@@ -212,6 +258,14 @@ private:
      */
     CalibrationType calibration_type{CalibrationType::SIDE_WALLS};
 
+    /**
+     * @brief Readings of the front sensors sampled along the distance sweep.
+     */
+    ///@{
+    std::vector<proxy::WallSensors::DistanceSample> left_front_samples;
+    std::vector<proxy::WallSensors::DistanceSample> right_front_samples;
+    ///@}
+
     /**
      * @brief Current action of the robot.
      */
@@ -227,6 +281,11 @@ private:
      */
     nav::RelativePose action_pose;
 
+    /**
+     * @brief Log of the corrections of the advance along the actions.
+     */
+    nav::CorrectionLog correction_log;
+
     /**
      * @brief Flag for when the robot has finished an objective.
      */
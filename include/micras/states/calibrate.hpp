@@ -27,6 +27,11 @@ public:
             return Micras::State::IDLE;
         }
 
+        // The distance sweep starts right after the front wall calibration, without moving the robot
+        if (this->micras.is_sweeping_distances()) {
+            return this->get_id();
+        }
+
         return Micras::State::WAIT_FOR_CALIBRATE;
     }
 };
@@ -34,6 +34,9 @@ public:
             return this->get_id();
         }
 
+        // The feed-forward gains estimated during the run are kept for the next ones
+        this->micras.save_calibration();
+
         switch (this->micras.get_objective()) {
             case core::Objective::EXPLORE:
                 this->micras.set_objective(core::Objective::RETURN);
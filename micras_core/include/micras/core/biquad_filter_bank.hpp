@@ -0,0 +1,236 @@
+/**
+ * @file
+ */
+
+#ifndef MICRAS_CORE_BIQUAD_FILTER_BANK_HPP
+#define MICRAS_CORE_BIQUAD_FILTER_BANK_HPP
+
+#include <array>
+#include <cstdint>
+#include <numbers>
+
+namespace micras::core {
+/**
+ * @brief Design of a Butterworth filter.
+ */
+struct FilterDesign {
+    /**
+     * @brief Response of the filter.
+     */
+    enum Type : uint8_t {
+        LOW_PASS = 0,
+        HIGH_PASS = 1,
+    };
+
+    Type  type;
+    float cutoff_frequency;
+    float sampling_frequency;
+};
+
+/**
+ * @brief Bank of identical Butterworth filters of any order, filtering several channels at once.
+ *
+ * @details The filters are cascades of second order sections, with a first order one for odd orders, in the
+ * transposed direct form II. The state is stored by section and then by channel, so each section runs over all the
+ * channels in a loop without branches or dependencies between its iterations, which the compiler can unroll and
+ * vectorize. The coefficients are designed by the bilinear transform with the cutoff frequency prewarped, and the
+ * design can be evaluated at compile time.
+ *
+ * @tparam num_of_channels Number of filtered channels.
+ * @tparam order Order of the filters.
+ */
+template <uint8_t num_of_channels, uint8_t order = 2>
+class TBiquadFilterBank {
+public:
+    static_assert(order >= 1, "The filters need at least one pole");
+
+    /**
+     * @brief Number of second order sections of each filter.
+     */
+    static constexpr uint8_t num_of_sections{(order + 1) / 2};
+
+    /**
+     * @brief Coefficients of a second order section, normalized by the leading coefficient of the denominator.
+     */
+    struct Section {
+        float b0;
+        float b1;
+        float b2;
+        float a1;
+        float a2;
+    };
+
+    /**
+     * @brief Coefficients of all the sections of a filter.
+     */
+    using Coefficients = std::array<Section, num_of_sections>;
+
+    /**
+     * @brief Design the coefficients of a Butterworth filter.
+     *
+     * @param design Type and cutoff frequency of the filter, which must be below half the sampling frequency.
+     * @return Coefficients of the sections of the filter.
+     */
+    static constexpr Coefficients design_butterworth(const FilterDesign& design) {
+        const double warped = tan(std::numbers::pi * design.cutoff_frequency / design.sampling_frequency);
+        const double warped_2 = warped * warped;
+        const bool   high_pass = (design.type == FilterDesign::HIGH_PASS);
+        Coefficients coefficients{};
+
+        for (uint8_t i = 0; i < order / 2; i++) {
+            // Each pair of conjugate poles is at this angle from the negative real axis of the continuous filter
+            const double damping = 2.0 * cos(std::numbers::pi * (2 * i + 1 + order % 2) / (2.0 * order));
+            const double norm = 1.0 / (1.0 + damping * warped + warped_2);
+            const double b0 = high_pass ? norm : warped_2 * norm;
+
+            coefficients[i] = {
+                .b0 = static_cast<float>(b0),
+                .b1 = static_cast<float>(high_pass ? -2.0 * b0 : 2.0 * b0),
+                .b2 = static_cast<float>(b0),
+                .a1 = static_cast<float>(2.0 * (warped_2 - 1.0) * norm),
+                .a2 = static_cast<float>((1.0 - damping * warped + warped_2) * norm),
+            };
+        }
+
+        if constexpr (order % 2 == 1) {
+            const double norm = 1.0 / (1.0 + warped);
+            const double b0 = high_pass ? norm : warped * norm;
+
+            coefficients[num_of_sections - 1] = {
+                .b0 = static_cast<float>(b0),
+                .b1 = static_cast<float>(high_pass ? -b0 : b0),
+                .b2 = 0.0F,
+                .a1 = static_cast<float>((warped - 1.0) * norm),
+                .a2 = 0.0F,
+            };
+        }
+
+        return coefficients;
+    }
+
+    /**
+     * @brief Construct a new Biquad Filter Bank object from designed coefficients.
+     *
+     * @param coefficients Coefficients of the sections of the filters.
+     */
+    constexpr explicit TBiquadFilterBank(const Coefficients& coefficients) : coefficients{coefficients} { }
+
+    /**
+     * @brief Construct a new Biquad Filter Bank object designing its coefficients.
+     *
+     * @param design Type and cutoff frequency of the filters.
+     */
+    constexpr explicit TBiquadFilterBank(const FilterDesign& design) : coefficients{design_butterworth(design)} { }
+
+    /**
+     * @brief Filter a new measure of each channel.
+     *
+     * @param inputs Last measure of each channel.
+     * @return Filtered value of each channel.
+     */
+    const std::array<float, num_of_channels>& update(const std::array<float, num_of_channels>& inputs) {
+        this->outputs = inputs;
+
+        for (uint8_t i = 0; i < num_of_sections; i++) {
+            const Section                       section = this->coefficients[i];
+            std::array<float, num_of_channels>& state_1 = this->states_1[i];
+            std::array<float, num_of_channels>& state_2 = this->states_2[i];
+
+            for (uint8_t j = 0; j < num_of_channels; j++) {
+                const float input = this->outputs[j];
+                const float output = section.b0 * input + state_1[j];
+
+                state_1[j] = section.b1 * input - section.a1 * output + state_2[j];
+                state_2[j] = section.b2 * input - section.a2 * output;
+                this->outputs[j] = output;
+            }
+        }
+
+        return this->outputs;
+    }
+
+    /**
+     * @brief Get the last filtered value of a channel.
+     *
+     * @param channel Index of the channel.
+     * @return Last filtered value.
+     */
+    float get_last(uint8_t channel) const { return this->outputs.at(channel); }
+
+    /**
+     * @brief Get the last filtered values of all channels.
+     *
+     * @return Last filtered value of each channel.
+     */
+    const std::array<float, num_of_channels>& get_outputs() const { return this->outputs; }
+
+    /**
+     * @brief Reset the state of the filters to zero.
+     */
+    void reset() {
+        this->states_1 = {};
+        this->states_2 = {};
+        this->outputs = {};
+    }
+
+private:
+    /**
+     * @brief Number of terms of the series of the trigonometric functions used in the design.
+     */
+    static constexpr uint8_t num_of_series_terms{12};
+
+    /**
+     * @brief Calculate the sine of an angle at compile time by its Taylor series.
+     *
+     * @param angle Angle between -pi and pi in radians.
+     * @return Sine of the angle.
+     */
+    static constexpr double sin(double angle) {
+        double term = angle;
+        double sum = angle;
+
+        for (uint8_t i = 1; i < num_of_series_terms; i++) {
+            term *= -angle * angle / ((2 * i) * (2 * i + 1));
+            sum += term;
+        }
+
+        return sum;
+    }
+
+    /**
+     * @brief Calculate the cosine of an angle at compile time by its Taylor series.
+     *
+     * @param angle Angle between -pi and pi in radians.
+     * @return Cosine of the angle.
+     */
+    static constexpr double cos(double angle) { return sin(std::numbers::pi / 2.0 - angle); }
+
+    /**
+     * @brief Calculate the tangent of an angle at compile time.
+     *
+     * @param angle Angle between -pi / 2 and pi / 2 in radians.
+     * @return Tangent of the angle.
+     */
+    static constexpr double tan(double angle) { return sin(angle) / cos(angle); }
+
+    /**
+     * @brief Coefficients of the sections of the filters.
+     */
+    Coefficients coefficients;
+
+    /**
+     * @brief States of each section of the filters, by section and then by channel.
+     */
+    ///@{
+    std::array<std::array<float, num_of_channels>, num_of_sections> states_1{};
+    std::array<std::array<float, num_of_channels>, num_of_sections> states_2{};
+    ///@}
+
+    /**
+     * @brief Last filtered value of each channel.
+     */
+    std::array<float, num_of_channels> outputs{};
+};
+}  // namespace micras::core
+
+#endif  // MICRAS_CORE_BIQUAD_FILTER_BANK_HPP
@@ -35,7 +35,7 @@ public:
     /**
      * @brief Construct a new Butterworth Second Order filter object.
      *
-     * @param cutoff_frequency Low-pass cutoff frequency in Hz.
+     * @param cutoff_frequency Low-pass cutoff angular frequency in rad/s.
      * @param sampling_frequency Sampling frequency in Hz.
      */
     explicit ButterworthFilter(float cutoff_frequency, float sampling_frequency = 100.0F);
@@ -48,6 +48,21 @@ public:
      */
     float update(float x0);
 
+    /**
+     * @brief Recalculate the coefficients of the filter, keeping its last values.
+     *
+     * @param cutoff_frequency Low-pass cutoff angular frequency in rad/s.
+     * @param sampling_frequency Sampling frequency in Hz.
+     */
+    void set_cutoff_frequency(float cutoff_frequency, float sampling_frequency);
+
+    /**
+     * @brief Get the delay of the filter for slow signals.
+     *
+     * @return Group delay of the filter at zero frequency in samples.
+     */
+    float get_delay() const;
+
     /**
      * @brief Get the last filtered value.
      *
@@ -61,6 +76,11 @@ private:
      */
     static constexpr uint8_t filter_order{2};
 
+    /**
+     * @brief Ratio between the cutoff and the sampling frequencies.
+     */
+    float relative_frequency{};
+
     /**
      * @brief Last input values of the filter.
      */
@@ -0,0 +1,94 @@
+/**
+ * @file
+ */
+
+#ifndef MICRAS_CORE_ENCODER_VELOCITY_ESTIMATOR_HPP
+#define MICRAS_CORE_ENCODER_VELOCITY_ESTIMATOR_HPP
+
+namespace micras::core {
+/**
+ * @brief Estimator of the velocity of an encoder, blending the period between its edges with the count difference.
+ *
+ * @details At low speed there are only a few counts in each update, so differencing the counts has a quantisation
+ * error of a whole count over the sample time. Instead, the counts since the last edge of the previous update are
+ * divided by the time between the last edges of each update, which is exact up to the capture resolution. While no
+ * edge arrives, the estimate decays to the fastest velocity that would not have produced one, reaching zero when the
+ * wheel stops.
+ *
+ * At high speed the count difference is precise enough and the edge period only adds the capture jitter, so the
+ * estimates are blended linearly between the configured velocities.
+ */
+class EncoderVelocityEstimator {
+public:
+    /**
+     * @brief Configuration struct for the EncoderVelocityEstimator class.
+     */
+    struct Config {
+        float min_blend_velocity;
+        float max_blend_velocity;
+    };
+
+    /**
+     * @brief Construct a new Encoder Velocity Estimator object.
+     *
+     * @param config Configuration for the estimator.
+     * @param step Position change of a single count of the encoder.
+     */
+    EncoderVelocityEstimator(const Config& config, float step);
+
+    /**
+     * @brief Update the estimate with a new position measurement.
+     *
+     * @param displacement Measured position change since the last update.
+     * @param edge_age Time since the last edge of the encoder in seconds, or zero if it is unknown.
+     * @param elapsed_time Time since the last update in seconds.
+     * @return The estimated velocity.
+     */
+    float update(float displacement, float edge_age, float elapsed_time);
+
+    /**
+     * @brief Get the last estimated velocity.
+     *
+     * @return Last estimated velocity.
+     */
+    float get_last() const;
+
+    /**
+     * @brief Reset the estimate to rest.
+     */
+    void reset();
+
+private:
+    /**
+     * @brief Velocity below which only the edge period is used.
+     */
+    float min_blend_velocity;
+
+    /**
+     * @brief Velocity above which only the count difference is used.
+     */
+    float max_blend_velocity;
+
+    /**
+     * @brief Position change of a single count of the encoder.
+     */
+    float step;
+
+    /**
+     * @brief Time since the last known edge of the encoder.
+     */
+    float edge_time{};
+
+    /**
+     * @brief Velocity estimated from the edge period.
+     */
+    float period_velocity{};
+
+    /**
+     * @brief Blended velocity.
+     */
+    float velocity{};
+};
+}  // namespace micras::core
+
+#endif  // MICRAS_CORE_ENCODER_VELOCITY_ESTIMATOR_HPP
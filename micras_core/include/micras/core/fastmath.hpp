@@ -0,0 +1,224 @@
+/**
+ * @file
+ */
+
+#ifndef MICRAS_CORE_FASTMATH_HPP
+#define MICRAS_CORE_FASTMATH_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+
+/**
+ * @brief Fast approximations of the math functions of the control loop.
+ *
+ * @details The approximations only use the single precision operations of the FPU, without the argument checks and
+ * the exact rounding of the standard library. The maximum errors are measured against the standard functions in
+ * double precision over the documented ranges.
+ */
+namespace micras::core::fastmath {
+/**
+ * @brief Whether the control loop uses the fast approximations, set by the FAST_MATH CMake option.
+ */
+#ifdef MICRAS_FAST_MATH
+constexpr bool enabled{true};
+#else
+constexpr bool enabled{false};
+#endif
+
+/**
+ * @brief Type to store the sine and the cosine of an angle.
+ */
+struct SinCos {
+    float sin;
+    float cos;
+};
+
+/**
+ * @brief Round a value to the nearest integer, with the halves away from zero.
+ *
+ * @param value Value to be rounded, with magnitude below 2^31.
+ * @return Nearest integer.
+ */
+constexpr int32_t round_to_int(float value) {
+    return static_cast<int32_t>(value + (value >= 0.0F ? 0.5F : -0.5F));
+}
+
+/**
+ * @brief Parts of half of pi, with the leading ones exact when multiplied by small integers.
+ */
+///@{
+constexpr float half_pi_high{1.5703125F};
+constexpr float half_pi_middle{4.837512969970703125e-4F};
+constexpr float half_pi_low{7.54978995489188216e-8F};
+///@}
+
+/**
+ * @brief Subtract a multiple of half of pi from an angle without losing its precision.
+ *
+ * @param angle Angle in radians.
+ * @param multiple Number of halves of pi to subtract.
+ * @return Reduced angle in radians.
+ */
+constexpr float reduce_angle(float angle, int32_t multiple) {
+    const auto multiple_float = static_cast<float>(multiple);
+
+    return ((angle - multiple_float * half_pi_high) - multiple_float * half_pi_middle) - multiple_float * half_pi_low;
+}
+
+/**
+ * @brief Wrap an angle to the range [-pi, pi].
+ *
+ * @param angle Angle in radians.
+ * @return Wrapped angle, with a maximum error of 2e-7 rad for angles up to 100 rad.
+ */
+constexpr float wrap_angle(float angle) {
+    return reduce_angle(angle, 4 * round_to_int(angle * std::numbers::inv_pi_v<float> / 2.0F));
+}
+
+/**
+ * @brief Calculate the sine and the cosine of an angle with minimax polynomials over an octant.
+ *
+ * @param angle Angle in radians.
+ * @return Sine and cosine of the angle, with a maximum error of 2e-7 for angles up to 100 rad.
+ */
+inline SinCos sincos(float angle) {
+    const int32_t quadrant = round_to_int(angle * 2.0F * std::numbers::inv_pi_v<float>);
+    const float   reduced = reduce_angle(angle, quadrant);
+    const float   reduced_2 = reduced * reduced;
+
+    const float sin_terms = -1.6666654611e-1F + reduced_2 * (8.3321608736e-3F - reduced_2 * 1.9515295891e-4F);
+    const float cos_terms = 4.1666645683e-2F + reduced_2 * (-1.3887316255e-3F + reduced_2 * 2.4433157118e-5F);
+    const float sin = reduced + reduced * reduced_2 * sin_terms;
+    const float cos = 1.0F - 0.5F * reduced_2 + reduced_2 * reduced_2 * cos_terms;
+
+    switch (quadrant & 3) {
+        case 0:
+            return {sin, cos};
+        case 1:
+            return {cos, -sin};
+        case 2:
+            return {-sin, -cos};
+        default:
+            return {-cos, sin};
+    }
+}
+
+/**
+ * @brief Calculate the angle of a point with a minimax polynomial over an octant.
+ *
+ * @param y Y coordinate of the point.
+ * @param x X coordinate of the point.
+ * @return Angle of the point in radians, from -pi to pi, with a maximum error of 3e-6 rad.
+ */
+inline float atan2(float y, float x) {
+    const float abs_x = std::abs(x);
+    const float abs_y = std::abs(y);
+    const float max = std::max(abs_x, abs_y);
+
+    if (max == 0.0F) {
+        return 0.0F;
+    }
+
+    const float ratio = std::min(abs_x, abs_y) / max;
+    const float ratio_2 = ratio * ratio;
+    const float ratio_4 = ratio_2 * ratio_2;
+
+    // The terms are grouped in pairs, so the multiplications of each pair do not wait for each other
+    const float low_terms = 0.99997726F - 0.33262347F * ratio_2;
+    const float middle_terms = 0.19354346F - 0.11643287F * ratio_2;
+    const float high_terms = 0.05265332F - 0.01172120F * ratio_2;
+
+    float angle = ratio * (low_terms + ratio_4 * (middle_terms + ratio_4 * high_terms));
+
+    if (abs_y > abs_x) {
+        angle = std::numbers::pi_v<float> / 2.0F - angle;
+    }
+
+    if (x < 0.0F) {
+        angle = std::numbers::pi_v<float> - angle;
+    }
+
+    return y < 0.0F ? -angle : angle;
+}
+
+/**
+ * @brief Calculate the length of the hypotenuse of a right triangle without scaling the sides.
+ *
+ * @param x Length of a side.
+ * @param y Length of the other side.
+ * @return Length of the hypotenuse, with a maximum relative error of 2e-7 for sides up to 1e18.
+ */
+inline float hypot(float x, float y) {
+    return std::sqrt(x * x + y * y);
+}
+
+/**
+ * @brief Calculate the inverse of the square root of a value from an estimate of its exponent.
+ *
+ * @param value Positive normal value.
+ * @return Inverse of the square root, with a maximum relative error of 5e-6 after two Newton iterations.
+ */
+constexpr float rsqrt(float value) {
+    float estimate = std::bit_cast<float>(0x5F3759DFU - (std::bit_cast<uint32_t>(value) >> 1U));
+
+    for (uint8_t i = 0; i < 2; i++) {
+        estimate *= 1.5F - 0.5F * value * estimate * estimate;
+    }
+
+    return estimate;
+}
+}  // namespace micras::core::fastmath
+
+/**
+ * @brief Math functions of the control loop, routed to the fast approximations if they are enabled.
+ */
+namespace micras::core::math {
+/**
+ * @brief Calculate the sine and the cosine of an angle.
+ *
+ * @param angle Angle in radians.
+ * @return Sine and cosine of the angle.
+ */
+inline fastmath::SinCos sincos(float angle) {
+    if constexpr (fastmath::enabled) {
+        return fastmath::sincos(angle);
+    } else {
+        return {std::sin(angle), std::cos(angle)};
+    }
+}
+
+/**
+ * @brief Calculate the angle of a point.
+ *
+ * @param y Y coordinate of the point.
+ * @param x X coordinate of the point.
+ * @return Angle of the point in radians, from -pi to pi.
+ */
+inline float atan2(float y, float x) {
+    if constexpr (fastmath::enabled) {
+        return fastmath::atan2(y, x);
+    } else {
+        return std::atan2(y, x);
+    }
+}
+
+/**
+ * @brief Calculate the length of the hypotenuse of a right triangle.
+ *
+ * @param x Length of a side.
+ * @param y Length of the other side.
+ * @return Length of the hypotenuse.
+ */
+inline float hypot(float x, float y) {
+    if constexpr (fastmath::enabled) {
+        return fastmath::hypot(x, y);
+    } else {
+        return std::hypot(x, y);
+    }
+}
+}  // namespace micras::core::math
+
+#endif  // MICRAS_CORE_FASTMATH_HPP
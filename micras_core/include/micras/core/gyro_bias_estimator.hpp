@@ -0,0 +1,173 @@
+/**
+ * @file
+ */
+
+#ifndef MICRAS_CORE_GYRO_BIAS_ESTIMATOR_HPP
+#define MICRAS_CORE_GYRO_BIAS_ESTIMATOR_HPP
+
+#include <array>
+
+namespace micras::core {
+/**
+ * @brief Class to estimate the bias of a gyroscope whenever the robot stands still.
+ *
+ * @details The robot is considered still when the wheels did not move and the variance of the accelerometer stayed
+ * low for a minimum time. While still, the gyroscope only measures its bias, which is fitted to a linear model of the
+ * temperature by recursive least squares with forgetting. The model keeps correcting the bias while the robot moves
+ * and heats up, until the next stop refreshes it.
+ */
+class GyroBiasEstimator {
+public:
+    /**
+     * @brief Configuration struct for the GyroBiasEstimator class.
+     */
+    struct Config {
+        float max_acceleration_variance;
+        float max_wheel_displacement;
+        float min_stationary_time;
+        float acceleration_time_constant;
+        float bias_time_constant;
+        float gyro_noise;
+        float initial_bias_deviation;
+        float reference_temperature;
+        float temperature_coefficient;
+        float temperature_coefficient_deviation;
+    };
+
+    /**
+     * @brief Type to store the measurements of a sample.
+     */
+    struct Sample {
+        float angular_velocity;
+        float linear_acceleration_x;
+        float linear_acceleration_y;
+        float temperature;
+        float left_wheel_position;
+        float right_wheel_position;
+    };
+
+    /**
+     * @brief Construct a new Gyro Bias Estimator object.
+     *
+     * @param config Configuration for the estimator.
+     */
+    explicit GyroBiasEstimator(const Config& config);
+
+    /**
+     * @brief Update the detection of the robot standing still and, if so, the bias model.
+     *
+     * @param sample Measurements of the sample, with the angular velocity including the bias.
+     * @param elapsed_time Time since the last update in seconds.
+     */
+    void update(const Sample& sample, float elapsed_time);
+
+    /**
+     * @brief Get the bias of the gyroscope at a temperature.
+     *
+     * @param temperature Temperature of the gyroscope in Celsius.
+     * @return The estimated bias in rad/s.
+     */
+    float get_bias(float temperature) const;
+
+    /**
+     * @brief Check if the robot is standing still.
+     *
+     * @return True if the robot was still for the minimum time, false otherwise.
+     */
+    bool is_stationary() const;
+
+    /**
+     * @brief Check if the bias was estimated at least once.
+     *
+     * @return True if the robot already stood still, false otherwise.
+     */
+    bool has_estimate() const;
+
+private:
+    /**
+     * @brief Fit the bias model to a sample taken while still.
+     *
+     * @param angular_velocity Measured angular velocity in rad/s.
+     * @param temperature Temperature of the gyroscope in Celsius.
+     * @param elapsed_time Time since the last update in seconds.
+     */
+    void update_model(float angular_velocity, float temperature, float elapsed_time);
+
+    /**
+     * @brief Maximum variance of the accelerometer to consider the robot still in (m/s^2)^2.
+     */
+    float max_acceleration_variance;
+
+    /**
+     * @brief Maximum rotation of the wheels to consider the robot still in radians.
+     */
+    float max_wheel_displacement;
+
+    /**
+     * @brief Minimum time still before estimating the bias in seconds.
+     */
+    float min_stationary_time;
+
+    /**
+     * @brief Time constant of the accelerometer mean and variance in seconds.
+     */
+    float acceleration_time_constant;
+
+    /**
+     * @brief Time constant of the forgetting of the bias model in seconds.
+     */
+    float bias_time_constant;
+
+    /**
+     * @brief Variance of the gyroscope noise in (rad/s)^2.
+     */
+    float gyro_variance;
+
+    /**
+     * @brief Temperature around which the bias model is linearized in Celsius.
+     */
+    float reference_temperature;
+
+    /**
+     * @brief Maximum variances of the model parameters, so they do not wind up when the temperature does not change.
+     */
+    std::array<float, 2> max_variances;
+
+    /**
+     * @brief Bias at the reference temperature and its change per degree.
+     */
+    std::array<float, 2> parameters;
+
+    /**
+     * @brief Covariance of the model parameters.
+     */
+    std::array<std::array<float, 2>, 2> covariance{};
+
+    /**
+     * @brief Mean of the accelerometer on each axis.
+     */
+    std::array<float, 2> acceleration_mean{};
+
+    /**
+     * @brief Variance of the accelerometer.
+     */
+    float acceleration_variance{};
+
+    /**
+     * @brief Wheel positions when the robot was last seen moving.
+     */
+    std::array<float, 2> still_wheel_positions{};
+
+    /**
+     * @brief Time the robot has been still in seconds.
+     */
+    float stationary_time{};
+
+    /**
+     * @brief Flag to check if the bias was estimated.
+     */
+    bool estimated{};
+};
+}  // namespace micras::core
+
+#endif  // MICRAS_CORE_GYRO_BIAS_ESTIMATOR_HPP
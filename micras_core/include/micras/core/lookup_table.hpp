@@ -0,0 +1,209 @@
+/**
+ * @file
+ */
+
+#ifndef MICRAS_CORE_LOOKUP_TABLE_HPP
+#define MICRAS_CORE_LOOKUP_TABLE_HPP
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <span>
+
+namespace micras::core {
+/**
+ * @brief Table of uniformly spaced samples of a function evaluated with linear interpolation.
+ *
+ * @tparam size Number of samples in the table.
+ */
+template <uint16_t size>
+class TLookupTable {
+public:
+    static_assert(size >= 2, "The lookup table needs at least two samples");
+
+    /**
+     * @brief Type to store a sample of a function at an arbitrary input.
+     */
+    struct Sample {
+        float input;
+        float value;
+    };
+
+    /**
+     * @brief Construct a new Lookup Table object sampling a function.
+     *
+     * @tparam F Type of the function.
+     * @param min_input Input of the first sample.
+     * @param max_input Input of the last sample.
+     * @param function Function to be sampled.
+     */
+    template <std::invocable<float> F>
+    TLookupTable(float min_input, float max_input, F function) :
+        min_input{min_input}, inverse_step{(size - 1) / (max_input - min_input)} {
+        const float step = (max_input - min_input) / (size - 1);
+
+        for (uint16_t i = 0; i < size; i++) {
+            this->values[i] = function(std::min(min_input + i * step, max_input));
+        }
+    }
+
+    /**
+     * @brief Evaluate the sampled function by interpolating the neighbour samples.
+     *
+     * @param input Input of the function.
+     * @return Interpolated value, saturated at the samples of the ends of the table.
+     */
+    float interpolate(float input) const {
+        const float position = (input - this->min_input) * this->inverse_step;
+
+        if (position <= 0.0F) {
+            return this->values[0];
+        }
+
+        if (position >= size - 1) {
+            return this->values[size - 1];
+        }
+
+        const auto  index = static_cast<uint16_t>(position);
+        const float fraction = position - index;
+
+        return this->values[index] + fraction * (this->values[index + 1] - this->values[index]);
+    }
+
+    /**
+     * @brief Fit the table to samples of a function at arbitrary inputs, like a calibration sweep.
+     *
+     * @param samples Samples of the function, in any order.
+     * @return True if the table was fitted, false if the samples cover less than two entries and it was kept.
+     *
+     * @details Each entry is the value at its input of a line fitted by weighted least squares to the samples up to
+     * one step away, weighted by their distance to it. Unlike averaging the samples, this has no bias where the
+     * function has a slope and the samples are only on one side of the entry, as in the ends of the sweep. Entries
+     * without samples are interpolated from the nearest fitted ones, or extrapolated past the ends of the sweep.
+     */
+    bool fit(std::span<const Sample> samples) {
+        std::array<std::array<float, 5>, size> sums{};
+
+        for (const auto& sample : samples) {
+            const float position = (sample.input - this->min_input) * this->inverse_step;
+
+            if (position <= -1.0F or position >= size) {
+                continue;
+            }
+
+            const auto first = static_cast<int32_t>(std::floor(position));
+
+            for (int32_t index = std::max(first, 0); index <= std::min(first + 1, size - 1); index++) {
+                const float offset = position - index;
+                const float weight = 1.0F - std::abs(offset);
+                auto&       entry_sums = sums[index];
+
+                entry_sums[0] += weight;
+                entry_sums[1] += weight * offset;
+                entry_sums[2] += weight * offset * offset;
+                entry_sums[3] += weight * sample.value;
+                entry_sums[4] += weight * offset * sample.value;
+            }
+        }
+
+        std::array<float, size> fitted_values{};
+        std::array<bool, size>  fitted{};
+        uint16_t                num_of_fitted{};
+
+        for (uint16_t i = 0; i < size; i++) {
+            const auto& [weight, offset, squared_offset, value, offset_value] = sums[i];
+
+            if (weight <= 0.0F) {
+                continue;
+            }
+
+            const float determinant = weight * squared_offset - offset * offset;
+
+            // With all samples at the same offset there is no slope, so the weighted average is used
+            fitted_values[i] = determinant > 1e-6F * weight * weight ?
+                                   (squared_offset * value - offset * offset_value) / determinant :
+                                   value / weight;
+            fitted[i] = true;
+            num_of_fitted++;
+        }
+
+        if (num_of_fitted < 2) {
+            return false;
+        }
+
+        for (uint16_t i = 0; i < size; i++) {
+            if (fitted[i]) {
+                continue;
+            }
+
+            // The closest fitted entries, taking both from the same side past the ends of the sweep
+            int32_t left = i - 1;
+            int32_t right = i + 1;
+
+            while (left >= 0 and not fitted[left]) {
+                left--;
+            }
+
+            while (right < size and not fitted[right]) {
+                right++;
+            }
+
+            if (left < 0) {
+                left = right;
+
+                do {
+                    right++;
+                } while (not fitted[right]);
+            } else if (right >= size) {
+                right = left;
+
+                do {
+                    left--;
+                } while (not fitted[left]);
+            }
+
+            const float fraction = static_cast<float>(i - left) / static_cast<float>(right - left);
+
+            fitted_values[i] = fitted_values[left] + fraction * (fitted_values[right] - fitted_values[left]);
+        }
+
+        this->values = fitted_values;
+
+        return true;
+    }
+
+    /**
+     * @brief Get the sampled values of the function.
+     *
+     * @return Values of the samples, from the first to the last input.
+     */
+    const std::array<float, size>& get_values() const { return this->values; }
+
+    /**
+     * @brief Set the sampled values of the function, like when loading a fitted table.
+     *
+     * @param values Values of the samples, from the first to the last input.
+     */
+    void set_values(const std::array<float, size>& values) { this->values = values; }
+
+private:
+    /**
+     * @brief Input of the first sample.
+     */
+    float min_input;
+
+    /**
+     * @brief Inverse of the distance between the inputs of two samples.
+     */
+    float inverse_step;
+
+    /**
+     * @brief Sampled values of the function.
+     */
+    std::array<float, size> values{};
+};
+}  // namespace micras::core
+
+#endif  // MICRAS_CORE_LOOKUP_TABLE_HPP
@@ -23,6 +23,17 @@ public:
         float max_integral{-1.0F};
     };
 
+    /**
+     * @brief Terms of the last response of the controller, for calibration.
+     */
+    struct Telemetry {
+        float error;
+        float proportional;
+        float integrative;
+        float derivative;
+        float response;
+    };
+
     /**
      * @brief Construct a new Pid Controller object.
      *
@@ -42,15 +53,22 @@ public:
      */
     void reset();
 
+    /**
+     * @brief Set a function to be called with the terms of each response.
+     *
+     * @param callback Function called with the context and the terms, or nullptr to stop calling it.
+     * @param context Context passed to the callback.
+     */
+    void set_telemetry_callback(void (*callback)(void* context, const Telemetry& telemetry), void* context);
+
     /**
      * @brief Update PID with new state and return response.
      *
      * @param state Current value of the controlled variable.
      * @param elapsed_time Time since the last update.
-     * @param save Whether to save the variables for calibration.
      * @return Response of the controller.
      */
-    float compute_response(float state, float elapsed_time, bool save = false);
+    float compute_response(float state, float elapsed_time);
 
     /**
      * @brief Update PID with new state and return response.
@@ -58,10 +76,9 @@ public:
      * @param state Current value of the controlled variable.
      * @param state_change Derivative of the controlled variable.
      * @param elapsed_time Time since the last update.
-     * @param save Whether to save the variables for calibration.
      * @return Response of the controller.
      */
-    float compute_response(float state, float elapsed_time, float state_change, bool save = false);
+    float compute_response(float state, float elapsed_time, float state_change);
 
 private:
     /**
@@ -108,6 +125,16 @@ private:
      * @brief Last response returned by the controller.
      */
     float last_response = 0;
+
+    /**
+     * @brief Function called with the terms of each response.
+     */
+    void (*telemetry_callback)(void* context, const Telemetry& telemetry){nullptr};
+
+    /**
+     * @brief Context passed to the telemetry callback.
+     */
+    void* telemetry_context{nullptr};
 };
 }  // namespace micras::core
 
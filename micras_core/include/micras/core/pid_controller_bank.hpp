@@ -0,0 +1,238 @@
+/**
+ * @file
+ */
+
+#ifndef MICRAS_CORE_PID_CONTROLLER_BANK_HPP
+#define MICRAS_CORE_PID_CONTROLLER_BANK_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+
+namespace micras::core {
+/**
+ * @brief Bank of PID controllers updated in a single pass.
+ *
+ * @details Response = kp * (setpoint_weight * setpoint - state + ki * integral(error) - kd * d/dt(state)), with the
+ * derivative of the state filtered by a first order low-pass filter. The integral is corrected by back-calculation,
+ * feeding back the difference between the saturated and the unsaturated responses, so it stops winding up while the
+ * response is saturated. The parameters and the states are stored by term and then by controller, so the update is a
+ * loop without branches or dependencies between its iterations, which the compiler can unroll and vectorize.
+ *
+ * @tparam num_of_controllers Number of controllers in the bank.
+ */
+template <uint8_t num_of_controllers>
+class TPidControllerBank {
+public:
+    /**
+     * @brief Configuration struct for each controller of the bank.
+     */
+    struct Config {
+        float kp{};
+        float ki{};
+        float kd{};
+        float setpoint_weight{1.0F};
+        float derivative_cutoff{-1.0F};
+        float tracking_gain{};
+        float saturation{-1.0F};
+    };
+
+    /**
+     * @brief Terms of the last responses of the controllers, for calibration.
+     */
+    struct Telemetry {
+        std::array<float, num_of_controllers> errors;
+        std::array<float, num_of_controllers> proportionals;
+        std::array<float, num_of_controllers> integratives;
+        std::array<float, num_of_controllers> derivatives;
+        std::array<float, num_of_controllers> responses;
+    };
+
+    /**
+     * @brief Construct a new Pid Controller Bank object.
+     *
+     * @param configs Parameters of each controller. A negative derivative cutoff frequency, in Hz, disables the
+     * derivative filter and a negative saturation disables the saturation. The tracking gain, in 1/s, sets how fast
+     * the integral is corrected while saturated, usually between ki and the square root of ki / kd.
+     */
+    explicit TPidControllerBank(const std::array<Config, num_of_controllers>& configs) {
+        for (uint8_t i = 0; i < num_of_controllers; i++) {
+            const Config& config = configs[i];
+
+            this->kp[i] = config.kp;
+            this->integral_gains[i] = config.kp * config.ki;
+            this->derivative_gains[i] = config.kp * config.kd;
+            this->setpoint_weights[i] = config.setpoint_weight;
+            this->derivative_time_constants[i] =
+                config.derivative_cutoff > 0.0F ? 1.0F / (2.0F * std::numbers::pi_v<float> * config.derivative_cutoff)
+                                                : 0.0F;
+            this->tracking_gains[i] = config.tracking_gain;
+            this->saturations[i] =
+                config.saturation >= 0.0F ? config.saturation : std::numeric_limits<float>::infinity();
+        }
+    }
+
+    /**
+     * @brief Set the desired setpoint of a controller.
+     *
+     * @param controller Index of the controller.
+     * @param setpoint Desired state.
+     */
+    void set_setpoint(uint8_t controller, float setpoint) { this->setpoints.at(controller) = setpoint; }
+
+    /**
+     * @brief Set the desired setpoints of all controllers.
+     *
+     * @param setpoints Desired state of each controller.
+     */
+    void set_setpoints(const std::array<float, num_of_controllers>& setpoints) { this->setpoints = setpoints; }
+
+    /**
+     * @brief Update all the controllers with new states and return their responses.
+     *
+     * @param states Current value of the variable controlled by each controller.
+     * @param elapsed_time Time since the last update.
+     * @return Response of each controller.
+     */
+    const std::array<float, num_of_controllers>&
+        update(const std::array<float, num_of_controllers>& states, float elapsed_time) {
+        // The first update has no previous state to differentiate
+        if (not this->has_previous_states) {
+            this->previous_states = states;
+            this->has_previous_states = true;
+        }
+
+        for (uint8_t i = 0; i < num_of_controllers; i++) {
+            const float error = this->setpoints[i] - states[i];
+            const float state_change = (states[i] - this->previous_states[i]) / elapsed_time;
+            const float filter_gain = elapsed_time / (this->derivative_time_constants[i] + elapsed_time);
+
+            this->state_changes[i] += filter_gain * (state_change - this->state_changes[i]);
+            this->previous_states[i] = states[i];
+
+            const float proportional = this->kp[i] * (this->setpoint_weights[i] * this->setpoints[i] - states[i]);
+            const float derivative = -this->derivative_gains[i] * this->state_changes[i];
+            const float response = proportional + this->integrals[i] + derivative;
+            const float saturated_response = std::clamp(response, -this->saturations[i], this->saturations[i]);
+
+            this->telemetry.errors[i] = error;
+            this->telemetry.proportionals[i] = proportional;
+            this->telemetry.integratives[i] = this->integrals[i];
+            this->telemetry.derivatives[i] = derivative;
+            this->telemetry.responses[i] = saturated_response;
+
+            this->integrals[i] += elapsed_time * (this->integral_gains[i] * error +
+                                                  this->tracking_gains[i] * (saturated_response - response));
+        }
+
+        if (this->telemetry_callback != nullptr) {
+            this->telemetry_callback(this->telemetry_context, this->telemetry);
+        }
+
+        return this->telemetry.responses;
+    }
+
+    /**
+     * @brief Get the last response of a controller.
+     *
+     * @param controller Index of the controller.
+     * @return Last response.
+     */
+    float get_last(uint8_t controller) const { return this->telemetry.responses.at(controller); }
+
+    /**
+     * @brief Set a function to be called with the terms of each update.
+     *
+     * @param callback Function called with the context and the terms, or nullptr to stop calling it.
+     * @param context Context passed to the callback.
+     */
+    void set_telemetry_callback(void (*callback)(void* context, const Telemetry& telemetry), void* context) {
+        this->telemetry_callback = callback;
+        this->telemetry_context = context;
+    }
+
+    /**
+     * @brief Reset the integrals and the derivatives of all controllers.
+     */
+    void reset() {
+        this->integrals = {};
+        this->state_changes = {};
+        this->has_previous_states = false;
+        this->telemetry = {};
+    }
+
+private:
+    /**
+     * @brief Gains of each controller, with the integrative and derivative ones multiplied by the proportional one.
+     */
+    ///@{
+    std::array<float, num_of_controllers> kp{};
+    std::array<float, num_of_controllers> integral_gains{};
+    std::array<float, num_of_controllers> derivative_gains{};
+    ///@}
+
+    /**
+     * @brief Weight of the setpoint in the proportional term of each controller.
+     */
+    std::array<float, num_of_controllers> setpoint_weights{};
+
+    /**
+     * @brief Time constant of the derivative filter of each controller.
+     */
+    std::array<float, num_of_controllers> derivative_time_constants{};
+
+    /**
+     * @brief Gain of the back-calculation of each controller.
+     */
+    std::array<float, num_of_controllers> tracking_gains{};
+
+    /**
+     * @brief Maximum response of each controller.
+     */
+    std::array<float, num_of_controllers> saturations{};
+
+    /**
+     * @brief Desired state of each controller.
+     */
+    std::array<float, num_of_controllers> setpoints{};
+
+    /**
+     * @brief Integrative term of each controller.
+     */
+    std::array<float, num_of_controllers> integrals{};
+
+    /**
+     * @brief Filtered derivative of the state of each controller.
+     */
+    std::array<float, num_of_controllers> state_changes{};
+
+    /**
+     * @brief Previous state of each controller for the derivative term.
+     */
+    std::array<float, num_of_controllers> previous_states{};
+
+    /**
+     * @brief Whether the previous states were set by an update.
+     */
+    bool has_previous_states{false};
+
+    /**
+     * @brief Terms of the last responses.
+     */
+    Telemetry telemetry{};
+
+    /**
+     * @brief Function called with the terms of each update.
+     */
+    void (*telemetry_callback)(void* context, const Telemetry& telemetry){nullptr};
+
+    /**
+     * @brief Context passed to the telemetry callback.
+     */
+    void* telemetry_context{nullptr};
+};
+}  // namespace micras::core
+
+#endif  // MICRAS_CORE_PID_CONTROLLER_BANK_HPP
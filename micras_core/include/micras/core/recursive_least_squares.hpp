@@ -0,0 +1,183 @@
+/**
+ * @file
+ */
+
+#ifndef MICRAS_CORE_RECURSIVE_LEAST_SQUARES_HPP
+#define MICRAS_CORE_RECURSIVE_LEAST_SQUARES_HPP
+
+#include <array>
+#include <cstdint>
+
+namespace micras::core {
+/**
+ * @brief Recursive least squares estimator of linear models sharing the same regressors.
+ *
+ * @details Each output is modeled as the dot product of its parameters with the regressors. As the regressors are the
+ * same for all outputs, they share the covariance matrix, which is updated once per sample. Old samples are forgotten
+ * exponentially, so the estimate follows slow changes of the parameters. While the regressors do not excite every
+ * direction, forgetting would make the covariance grow without bound, so it stops when the trace of the covariance
+ * reaches its maximum.
+ *
+ * @tparam num_of_parameters Number of parameters of each model.
+ * @tparam num_of_outputs Number of estimated models.
+ */
+template <uint8_t num_of_parameters, uint8_t num_of_outputs = 1>
+class TRecursiveLeastSquares {
+public:
+    /**
+     * @brief Configuration struct for the recursive least squares estimator.
+     */
+    struct Config {
+        float forgetting_factor{1.0F};
+        float initial_covariance{};
+        float max_covariance_trace{};
+    };
+
+    /**
+     * @brief Type to store the regressors of a sample.
+     */
+    using Regressors = std::array<float, num_of_parameters>;
+
+    /**
+     * @brief Type to store the parameters of a model.
+     */
+    using Parameters = std::array<float, num_of_parameters>;
+
+    /**
+     * @brief Construct a new Recursive Least Squares object.
+     *
+     * @param config Configuration for the estimator.
+     * @param initial_parameters Initial guess of the parameters of each model.
+     */
+    TRecursiveLeastSquares(const Config& config, const std::array<Parameters, num_of_outputs>& initial_parameters) :
+        forgetting_factor{config.forgetting_factor},
+        initial_covariance{config.initial_covariance},
+        max_covariance_trace{config.max_covariance_trace},
+        parameters{initial_parameters} {
+        this->reset_covariance();
+    }
+
+    /**
+     * @brief Update the estimate with a new sample.
+     *
+     * @param regressors Regressors of the sample.
+     * @param outputs Measured output of each model.
+     */
+    void update(const Regressors& regressors, const std::array<float, num_of_outputs>& outputs) {
+        // The gain is the covariance times the regressors, normalized by the variance of the prediction
+        std::array<float, num_of_parameters> gain{};
+        float                                prediction_variance = this->forgetting_factor;
+
+        for (uint8_t i = 0; i < num_of_parameters; i++) {
+            for (uint8_t j = 0; j < num_of_parameters; j++) {
+                gain[i] += this->covariance[i][j] * regressors[j];
+            }
+
+            prediction_variance += regressors[i] * gain[i];
+        }
+
+        for (uint8_t k = 0; k < num_of_outputs; k++) {
+            float error = outputs[k];
+
+            for (uint8_t i = 0; i < num_of_parameters; i++) {
+                error -= this->parameters[k][i] * regressors[i];
+            }
+
+            for (uint8_t i = 0; i < num_of_parameters; i++) {
+                this->parameters[k][i] += gain[i] * error / prediction_variance;
+            }
+        }
+
+        float trace{};
+
+        for (uint8_t i = 0; i < num_of_parameters; i++) {
+            trace += this->covariance[i][i];
+        }
+
+        const float forgetting = trace < this->max_covariance_trace ? this->forgetting_factor : 1.0F;
+
+        // Only the upper triangle is computed and mirrored, so the covariance stays symmetric
+        for (uint8_t i = 0; i < num_of_parameters; i++) {
+            for (uint8_t j = i; j < num_of_parameters; j++) {
+                const float correction = gain[i] * gain[j] / prediction_variance;
+
+                this->covariance[i][j] = (this->covariance[i][j] - correction) / forgetting;
+                this->covariance[j][i] = this->covariance[i][j];
+            }
+        }
+
+        this->num_of_samples++;
+    }
+
+    /**
+     * @brief Get the estimated parameters of a model.
+     *
+     * @param output Index of the model.
+     * @return Estimated parameters.
+     */
+    const Parameters& get_parameters(uint8_t output) const { return this->parameters.at(output); }
+
+    /**
+     * @brief Get the number of samples used since the last reset.
+     *
+     * @return Number of samples.
+     */
+    uint32_t get_num_of_samples() const { return this->num_of_samples; }
+
+    /**
+     * @brief Restart the estimate from new parameters, with the initial covariance.
+     *
+     * @param parameters New guess of the parameters of each model.
+     */
+    void reset(const std::array<Parameters, num_of_outputs>& parameters) {
+        this->parameters = parameters;
+        this->reset_covariance();
+    }
+
+private:
+    /**
+     * @brief Set the covariance to the initial diagonal matrix.
+     */
+    void reset_covariance() {
+        this->covariance = {};
+
+        for (uint8_t i = 0; i < num_of_parameters; i++) {
+            this->covariance[i][i] = this->initial_covariance;
+        }
+
+        this->num_of_samples = 0;
+    }
+
+    /**
+     * @brief Weight of the previous samples in each update.
+     */
+    float forgetting_factor;
+
+    /**
+     * @brief Initial variance of each parameter.
+     */
+    float initial_covariance;
+
+    /**
+     * @brief Trace of the covariance above which the samples are not forgotten.
+     */
+    float max_covariance_trace;
+
+    /**
+     * @brief Estimated parameters of each model.
+     */
+    std::array<Parameters, num_of_outputs> parameters;
+
+    /**
+     * @brief Covariance of the estimated parameters, shared by all models.
+     */
+    std::array<std::array<float, num_of_parameters>, num_of_parameters> covariance{};
+
+    /**
+     * @brief Number of samples used since the last reset.
+     */
+    uint32_t num_of_samples{};
+};
+}  // namespace micras::core
+
+#endif  // MICRAS_CORE_RECURSIVE_LEAST_SQUARES_HPP
@@ -0,0 +1,88 @@
+/**
+ * @file
+ */
+
+#ifndef MICRAS_CORE_SPEED_ADAPTIVE_FILTER_HPP
+#define MICRAS_CORE_SPEED_ADAPTIVE_FILTER_HPP
+
+#include "micras/core/butterworth_filter.hpp"
+
+namespace micras::core {
+/**
+ * @brief Low-pass filter of a signal sampled along the path of the robot, with a cutoff proportional to its speed.
+ *
+ * @details A fixed cutoff delays the signal by a fixed time, so features along the path, like the posts seen by the
+ * wall sensors, are found further behind them the faster the robot goes. Scaling the cutoff with the linear speed
+ * keeps the same cutoff in space instead, delaying the signal by a fixed distance that can be compensated. The
+ * cutoff is limited at low speeds, where the filter would stop following the signal, and at high speeds, where it
+ * would stop rejecting the noise.
+ */
+class SpeedAdaptiveFilter {
+public:
+    /**
+     * @brief Configuration struct for the SpeedAdaptiveFilter class.
+     */
+    struct Config {
+        float min_cutoff;
+        float max_cutoff;
+        float spatial_cutoff;
+    };
+
+    /**
+     * @brief Construct a new Speed Adaptive Filter object.
+     *
+     * @param config Configuration for the filter.
+     */
+    explicit SpeedAdaptiveFilter(const Config& config);
+
+    /**
+     * @brief Produce a new value from measured data.
+     *
+     * @param x0 Last measure.
+     * @param linear_speed Current linear speed of the robot in m/s.
+     * @param elapsed_time Time since the last measure in seconds.
+     * @return Filtered value.
+     */
+    float update(float x0, float linear_speed, float elapsed_time);
+
+    /**
+     * @brief Get the last filtered value.
+     *
+     * @return Last filtered value.
+     */
+    float get_last() const;
+
+    /**
+     * @brief Get the distance travelled during the delay of the last filtered value.
+     *
+     * @return Delay of the filter in meters.
+     */
+    float get_lag() const;
+
+private:
+    /**
+     * @brief Cutoff angular frequencies limiting the adaptation in rad/s.
+     */
+    ///@{
+    float min_cutoff;
+    float max_cutoff;
+    ///@}
+
+    /**
+     * @brief Cutoff angular frequency per linear speed in rad/m.
+     */
+    float spatial_cutoff;
+
+    /**
+     * @brief Butterworth filter with the adapted cutoff.
+     */
+    ButterworthFilter filter;
+
+    /**
+     * @brief Distance travelled during the delay of the last filtered value.
+     */
+    float lag{};
+};
+}  // namespace micras::core
+
+#endif  // MICRAS_CORE_SPEED_ADAPTIVE_FILTER_HPP
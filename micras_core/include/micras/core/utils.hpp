@@ -10,6 +10,8 @@
 #include <cmath>
 #include <numbers>
 
+#include "micras/core/fastmath.hpp"
+
 namespace micras::core {
 /**
  * @brief Remap a value from one range to another.
@@ -95,6 +97,10 @@ constexpr std::array<T, N> make_array(C value) {
  * @return Asserted angle.
  */
 constexpr float assert_angle(float angle) {
+    if constexpr (fastmath::enabled) {
+        return fastmath::wrap_angle(angle);
+    }
+
     angle = std::fmod(angle, 2 * std::numbers::pi_v<float>);
 
     if (angle > std::numbers::pi_v<float>) {
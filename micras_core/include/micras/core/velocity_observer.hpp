@@ -0,0 +1,83 @@
+/**
+ * @file
+ */
+
+#ifndef MICRAS_CORE_VELOCITY_OBSERVER_HPP
+#define MICRAS_CORE_VELOCITY_OBSERVER_HPP
+
+namespace micras::core {
+/**
+ * @brief Alpha-beta tracker estimating a velocity from position measurements and a known acceleration.
+ *
+ * @details The position and velocity are predicted with the commanded acceleration and corrected by the difference
+ * between the predicted and measured positions. The alpha and beta gains are the steady state gains of the Kalman
+ * filter for the configured noises, calculated from the tracking index of the sample time. Since the acceleration is
+ * part of the prediction, the estimate has no lag while the robot follows the commanded acceleration, unlike a low
+ * pass filter over the differentiated position.
+ *
+ * The position estimate is stored relative to the last measurement, so the precision does not degrade as the
+ * measured position grows.
+ */
+class VelocityObserver {
+public:
+    /**
+     * @brief Configuration struct for the VelocityObserver class.
+     */
+    struct Config {
+        float process_noise;
+        float measurement_noise;
+    };
+
+    /**
+     * @brief Construct a new Velocity Observer object.
+     *
+     * @param config Configuration for the observer.
+     */
+    explicit VelocityObserver(const Config& config);
+
+    /**
+     * @brief Update the estimate with a new position measurement.
+     *
+     * @param displacement Measured position change since the last update.
+     * @param acceleration Commanded acceleration since the last update.
+     * @param elapsed_time Time since the last update in seconds.
+     * @return The estimated velocity.
+     */
+    float update(float displacement, float acceleration, float elapsed_time);
+
+    /**
+     * @brief Get the last estimated velocity.
+     *
+     * @return Last estimated velocity.
+     */
+    float get_last() const;
+
+    /**
+     * @brief Reset the estimate to rest.
+     */
+    void reset();
+
+private:
+    /**
+     * @brief Standard deviation of the unmodelled acceleration.
+     */
+    float process_noise;
+
+    /**
+     * @brief Standard deviation of the position measurement.
+     */
+    float measurement_noise;
+
+    /**
+     * @brief Estimated position relative to the last measurement.
+     */
+    float position_offset{};
+
+    /**
+     * @brief Estimated velocity.
+     */
+    float velocity{};
+};
+}  // namespace micras::core
+
+#endif  // MICRAS_CORE_VELOCITY_OBSERVER_HPP
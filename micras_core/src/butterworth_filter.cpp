@@ -9,24 +9,7 @@
 
 namespace micras::core {
 ButterworthFilter::ButterworthFilter(float cutoff_frequency, float sampling_frequency) {
-    const float relative_frequency = cutoff_frequency / sampling_frequency;
-    const float relative_frequency_2 = relative_frequency * relative_frequency;
-
-    const float b0 = 1;
-    const float b1 = 2;
-    const float b2 = 1;
-
-    // Butterworth filter coefficients
-    const float a0 = 1 + 2 * std::numbers::sqrt2_v<float> / relative_frequency + 4 / relative_frequency_2;
-    const float a1 = 2 - 8 / relative_frequency_2;
-    const float a2 = 1 - 2 * std::numbers::sqrt2_v<float> / relative_frequency + 4 / relative_frequency_2;
-
-    this->a_array[0] = a2 / a0;
-    this->a_array[1] = a1 / a0;
-
-    this->b_array[0] = b2 / a0;
-    this->b_array[1] = b1 / a0;
-    this->b_array[2] = b0 / a0;
+    this->set_cutoff_frequency(cutoff_frequency, sampling_frequency);
 }
 
 float ButterworthFilter::update(float x0) {
@@ -54,6 +37,34 @@ float ButterworthFilter::update(float x0) {
     return y0;
 }
 
+void ButterworthFilter::set_cutoff_frequency(float cutoff_frequency, float sampling_frequency) {
+    this->relative_frequency = cutoff_frequency / sampling_frequency;
+
+    const float relative_frequency = this->relative_frequency;
+    const float relative_frequency_2 = relative_frequency * relative_frequency;
+
+    const float b0 = 1;
+    const float b1 = 2;
+    const float b2 = 1;
+
+    // Butterworth filter coefficients
+    const float a0 = 1 + 2 * std::numbers::sqrt2_v<float> / relative_frequency + 4 / relative_frequency_2;
+    const float a1 = 2 - 8 / relative_frequency_2;
+    const float a2 = 1 - 2 * std::numbers::sqrt2_v<float> / relative_frequency + 4 / relative_frequency_2;
+
+    this->a_array[0] = a2 / a0;
+    this->a_array[1] = a1 / a0;
+
+    this->b_array[0] = b2 / a0;
+    this->b_array[1] = b1 / a0;
+    this->b_array[2] = b0 / a0;
+}
+
+float ButterworthFilter::get_delay() const {
+    // The bilinear transform keeps the group delay at zero frequency of the continuous filter
+    return std::numbers::sqrt2_v<float> / this->relative_frequency;
+}
+
 float ButterworthFilter::get_last() const {
     return this->y_array[1];
 }
@@ -0,0 +1,51 @@
+/**
+ * @file
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include "micras/core/encoder_velocity_estimator.hpp"
+
+namespace micras::core {
+EncoderVelocityEstimator::EncoderVelocityEstimator(const Config& config, float step) :
+    min_blend_velocity{config.min_blend_velocity}, max_blend_velocity{config.max_blend_velocity}, step{step} { }
+
+float EncoderVelocityEstimator::update(float displacement, float edge_age, float elapsed_time) {
+    if (elapsed_time <= 0.0F) {
+        return this->velocity;
+    }
+
+    this->edge_time += elapsed_time;
+
+    if (displacement != 0.0F) {
+        // The position only changes on edges, so the displacement happened between the last edges of each update
+        const float edge_period = this->edge_time - std::min(edge_age, elapsed_time);
+
+        this->period_velocity = displacement / std::max(edge_period, this->step / this->max_blend_velocity);
+        this->edge_time -= edge_period;
+    } else if (std::abs(this->period_velocity) * this->edge_time > this->step) {
+        this->period_velocity = std::copysign(this->step / this->edge_time, this->period_velocity);
+    }
+
+    const float count_velocity = displacement / elapsed_time;
+    const float weight = std::clamp(
+        (std::abs(count_velocity) - this->min_blend_velocity) / (this->max_blend_velocity - this->min_blend_velocity),
+        0.0F, 1.0F
+    );
+
+    this->velocity = this->period_velocity + weight * (count_velocity - this->period_velocity);
+
+    return this->velocity;
+}
+
+float EncoderVelocityEstimator::get_last() const {
+    return this->velocity;
+}
+
+void EncoderVelocityEstimator::reset() {
+    this->edge_time = 0.0F;
+    this->period_velocity = 0.0F;
+    this->velocity = 0.0F;
+}
+}  // namespace micras::core
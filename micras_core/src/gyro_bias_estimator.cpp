@@ -0,0 +1,106 @@
+/**
+ * @file
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#include "micras/core/gyro_bias_estimator.hpp"
+
+namespace micras::core {
+GyroBiasEstimator::GyroBiasEstimator(const Config& config) :
+    max_acceleration_variance{config.max_acceleration_variance},
+    max_wheel_displacement{config.max_wheel_displacement},
+    min_stationary_time{config.min_stationary_time},
+    acceleration_time_constant{config.acceleration_time_constant},
+    bias_time_constant{config.bias_time_constant},
+    gyro_variance{config.gyro_noise * config.gyro_noise},
+    reference_temperature{config.reference_temperature},
+    max_variances{
+        config.initial_bias_deviation * config.initial_bias_deviation,
+        config.temperature_coefficient_deviation * config.temperature_coefficient_deviation
+    },
+    parameters{0.0F, config.temperature_coefficient} {
+    this->covariance[0][0] = this->max_variances[0];
+    this->covariance[1][1] = this->max_variances[1];
+}
+
+void GyroBiasEstimator::update(const Sample& sample, float elapsed_time) {
+    const float smoothing = std::fminf(elapsed_time / this->acceleration_time_constant, 1.0F);
+
+    this->acceleration_mean[0] += smoothing * (sample.linear_acceleration_x - this->acceleration_mean[0]);
+    this->acceleration_mean[1] += smoothing * (sample.linear_acceleration_y - this->acceleration_mean[1]);
+    this->acceleration_variance +=
+        smoothing * (std::pow(sample.linear_acceleration_x - this->acceleration_mean[0], 2.0F) +
+                     std::pow(sample.linear_acceleration_y - this->acceleration_mean[1], 2.0F) -
+                     this->acceleration_variance);
+
+    // Slow movements are caught once they add up to the maximum displacement, since the reference is kept until then
+    if (std::abs(sample.left_wheel_position - this->still_wheel_positions[0]) > this->max_wheel_displacement or
+        std::abs(sample.right_wheel_position - this->still_wheel_positions[1]) > this->max_wheel_displacement or
+        this->acceleration_variance > this->max_acceleration_variance) {
+        this->still_wheel_positions = {sample.left_wheel_position, sample.right_wheel_position};
+        this->stationary_time = 0.0F;
+        return;
+    }
+
+    this->stationary_time += elapsed_time;
+
+    if (this->is_stationary()) {
+        this->update_model(sample.angular_velocity, sample.temperature, elapsed_time);
+    }
+}
+
+float GyroBiasEstimator::get_bias(float temperature) const {
+    return this->parameters[0] + this->parameters[1] * (temperature - this->reference_temperature);
+}
+
+bool GyroBiasEstimator::is_stationary() const {
+    return this->stationary_time >= this->min_stationary_time;
+}
+
+bool GyroBiasEstimator::has_estimate() const {
+    return this->estimated;
+}
+
+void GyroBiasEstimator::update_model(float angular_velocity, float temperature, float elapsed_time) {
+    const std::array<float, 2> regressor{1.0F, temperature - this->reference_temperature};
+    const float                forgetting = std::fmaxf(1.0F - elapsed_time / this->bias_time_constant, 0.5F);
+
+    std::array<float, 2> covariance_regressor{};
+    float                innovation_variance = this->gyro_variance;
+
+    for (uint8_t i = 0; i < 2; i++) {
+        for (uint8_t j = 0; j < 2; j++) {
+            this->covariance[i][j] /= forgetting;
+            covariance_regressor[i] += this->covariance[i][j] * regressor[j];
+        }
+
+        innovation_variance += regressor[i] * covariance_regressor[i];
+    }
+
+    const float residual = angular_velocity - this->get_bias(temperature);
+
+    for (uint8_t i = 0; i < 2; i++) {
+        const float gain = covariance_regressor[i] / innovation_variance;
+
+        this->parameters[i] += gain * residual;
+
+        for (uint8_t j = 0; j < 2; j++) {
+            this->covariance[i][j] -= gain * covariance_regressor[j];
+        }
+    }
+
+    // The forgetting inflates the covariance in the directions the data does not excite, which is bounded by the prior
+    for (uint8_t i = 0; i < 2; i++) {
+        this->covariance[i][i] = std::fminf(this->covariance[i][i], this->max_variances[i]);
+    }
+
+    const float max_cross_covariance = std::sqrt(this->covariance[0][0] * this->covariance[1][1]);
+
+    this->covariance[0][1] = std::clamp(this->covariance[0][1], -max_cross_covariance, max_cross_covariance);
+    this->covariance[1][0] = this->covariance[0][1];
+    this->estimated = true;
+}
+}  // namespace micras::core
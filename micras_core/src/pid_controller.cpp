@@ -7,15 +7,6 @@
 
 #include "micras/core/pid_controller.hpp"
 
-// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
-static volatile float test_error;
-static volatile float test_proportional;
-static volatile float test_integrative;
-static volatile float test_derivative;
-static volatile float test_response;
-
-// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
-
 namespace micras::core {
 PidController::PidController(Config config) :
     kp{config.kp},
@@ -35,29 +26,38 @@ void PidController::reset() {
     this->last_response = 0;
 }
 
-float PidController::compute_response(float state, float elapsed_time, bool save) {
+void PidController::set_telemetry_callback(void (*callback)(void* context, const Telemetry& telemetry), void* context) {
+    this->telemetry_callback = callback;
+    this->telemetry_context = context;
+}
+
+float PidController::compute_response(float state, float elapsed_time) {
     const float state_change = (state - this->prev_state) / elapsed_time;
-    return this->compute_response(state, elapsed_time, state_change, save);
+    return this->compute_response(state, elapsed_time, state_change);
 }
 
-float PidController::compute_response(float state, float elapsed_time, float state_change, bool save) {
+float PidController::compute_response(float state, float elapsed_time, float state_change) {
     const float error = this->setpoint - state;
     this->prev_state = state;
 
-    float response = this->kp * (error + this->ki * this->error_acc - this->kd * state_change);
+    // The proportional and derivative terms do not depend on the integral, so they are only computed once
+    const float proportional = this->kp * error;
+    const float derivative = -this->kp * this->kd * state_change;
+    const float integral_gain = this->kp * this->ki;
+    const float unclamped_response = proportional + integral_gain * this->error_acc + derivative;
 
-    if (this->saturation < 0 or std::abs(response) < this->saturation or
+    if (this->saturation < 0 or std::abs(unclamped_response) < this->saturation or
         (this->error_acc != 0 and std::signbit(this->error_acc) != std::signbit(error))) {
         this->error_acc += error * elapsed_time;
     }
 
     if (this->max_integral >= 0 and this->ki > 0) {
-        this->error_acc = std::clamp(
-            this->error_acc, -this->max_integral / (this->kp * this->ki), this->max_integral / (this->kp * this->ki)
-        );
+        const float max_error_acc = this->max_integral / integral_gain;
+        this->error_acc = std::clamp(this->error_acc, -max_error_acc, max_error_acc);
     }
 
-    response = this->kp * (error + this->ki * this->error_acc - this->kd * state_change);
+    const float integrative = integral_gain * this->error_acc;
+    float       response = proportional + integrative + derivative;
 
     if (this->saturation >= 0 and std::abs(response) >= this->saturation) {
         response = std::clamp(response, -this->saturation, this->saturation);
@@ -65,12 +65,8 @@ float PidController::compute_response(float state, float elapsed_time, float sta
 
     this->last_response = response;
 
-    if (save) {
-        test_error = error;
-        test_proportional = this->kp * error;
-        test_integrative = this->kp * this->ki * this->error_acc;
-        test_derivative = -this->kp * this->kd * state_change;
-        test_response = response;
+    if (this->telemetry_callback != nullptr) {
+        this->telemetry_callback(this->telemetry_context, {error, proportional, integrative, derivative, response});
     }
 
     return response;
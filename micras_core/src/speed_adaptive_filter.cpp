@@ -0,0 +1,38 @@
+/**
+ * @file
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include "micras/core/speed_adaptive_filter.hpp"
+
+namespace micras::core {
+SpeedAdaptiveFilter::SpeedAdaptiveFilter(const Config& config) :
+    min_cutoff{config.min_cutoff},
+    max_cutoff{config.max_cutoff},
+    spatial_cutoff{config.spatial_cutoff},
+    filter{config.min_cutoff} { }
+
+float SpeedAdaptiveFilter::update(float x0, float linear_speed, float elapsed_time) {
+    if (elapsed_time <= 0.0F) {
+        return this->filter.get_last();
+    }
+
+    const float speed = std::abs(linear_speed);
+    const float cutoff = std::clamp(this->spatial_cutoff * speed, this->min_cutoff, this->max_cutoff);
+
+    this->filter.set_cutoff_frequency(cutoff, 1.0F / elapsed_time);
+    this->lag = speed * this->filter.get_delay() * elapsed_time;
+
+    return this->filter.update(x0);
+}
+
+float SpeedAdaptiveFilter::get_last() const {
+    return this->filter.get_last();
+}
+
+float SpeedAdaptiveFilter::get_lag() const {
+    return this->lag;
+}
+}  // namespace micras::core
@@ -4,24 +4,26 @@
 
 #include <cmath>
 
+#include "micras/core/fastmath.hpp"
 #include "micras/core/vector.hpp"
 
 namespace micras::core {
 float Vector::distance(const Vector& other) const {
-    return std::hypot(other.x - this->x, other.y - this->y);
+    return math::hypot(other.x - this->x, other.y - this->y);
 }
 
 float Vector::magnitude() const {
-    return std::hypot(this->x, this->y);
+    return math::hypot(this->x, this->y);
 }
 
 float Vector::angle_between(const Vector& other) const {
-    return std::atan2(other.y - this->y, other.x - this->x);
+    return math::atan2(other.y - this->y, other.x - this->x);
 }
 
 Vector Vector::move_towards(const Vector& other, float distance) const {
     const float angle = this->angle_between(other);
-    return {this->x + distance * std::cos(angle), this->y + distance * std::sin(angle)};
+    const auto [sin, cos] = math::sincos(angle);
+    return {this->x + distance * cos, this->y + distance * sin};
 }
 
 Vector Vector::operator+(const Vector& other) const {
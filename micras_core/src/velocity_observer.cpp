@@ -0,0 +1,42 @@
+/**
+ * @file
+ */
+
+#include <cmath>
+
+#include "micras/core/velocity_observer.hpp"
+
+namespace micras::core {
+VelocityObserver::VelocityObserver(const Config& config) :
+    process_noise{config.process_noise}, measurement_noise{config.measurement_noise} { }
+
+float VelocityObserver::update(float displacement, float acceleration, float elapsed_time) {
+    if (elapsed_time <= 0.0F) {
+        return this->velocity;
+    }
+
+    // Steady state Kalman gains for a constant acceleration model, from Kalata's tracking index
+    const float tracking_index = this->process_noise * elapsed_time * elapsed_time / this->measurement_noise;
+    const float r = (4.0F + tracking_index - std::sqrt(8.0F * tracking_index + tracking_index * tracking_index)) / 4.0F;
+    const float alpha = 1.0F - r * r;
+    const float beta = 2.0F * (2.0F - alpha) - 4.0F * std::sqrt(1.0F - alpha);
+
+    const float predicted_offset = this->position_offset + this->velocity * elapsed_time +
+                                   acceleration * elapsed_time * elapsed_time / 2.0F - displacement;
+    const float residual = -predicted_offset;
+
+    this->position_offset = predicted_offset + alpha * residual;
+    this->velocity += acceleration * elapsed_time + beta * residual / elapsed_time;
+
+    return this->velocity;
+}
+
+float VelocityObserver::get_last() const {
+    return this->velocity;
+}
+
+void VelocityObserver::reset() {
+    this->position_offset = 0.0F;
+    this->velocity = 0.0F;
+}
+}  // namespace micras::core
@@ -50,6 +50,26 @@ public:
      */
     void stop_dma();
 
+    /**
+     * @brief Set a function to be called when each half of the DMA buffer is filled.
+     *
+     * @param callback Function called from the DMA interrupt with the context and the index of the filled half.
+     * @param context Context passed to the callback.
+     *
+     * @details The object registers itself to receive the interrupts, so it must not be moved afterwards.
+     */
+    void set_transfer_callback(void (*callback)(void* context, uint8_t half), void* context);
+
+    /**
+     * @brief Call the transfer callback of the object handling an ADC.
+     *
+     * @param handle ADC handle whose DMA transfer completed.
+     * @param half Index of the filled half of the buffer.
+     *
+     * @details This is called by the HAL conversion complete callbacks.
+     */
+    static void process_transfer(ADC_HandleTypeDef* handle, uint8_t half);
+
     /**
      * @brief Get the maximum reading of the ADC.
      *
@@ -72,6 +92,16 @@ private:
      * @brief ADC handle.
      */
     ADC_HandleTypeDef* handle;
+
+    /**
+     * @brief Function called when each half of the DMA buffer is filled.
+     */
+    void (*transfer_callback)(void* context, uint8_t half){nullptr};
+
+    /**
+     * @brief Context passed to the transfer callback.
+     */
+    void* transfer_context{nullptr};
 };
 }  // namespace micras::hal
 
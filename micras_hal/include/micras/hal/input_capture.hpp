@@ -0,0 +1,58 @@
+/**
+ * @file
+ */
+
+#ifndef MICRAS_HAL_INPUT_CAPTURE_HPP
+#define MICRAS_HAL_INPUT_CAPTURE_HPP
+
+#include <cstdint>
+#include <tim.h>
+
+namespace micras::hal {
+/**
+ * @brief Class to handle the input capture of a timer peripheral on STM32 microcontrollers.
+ */
+class InputCapture {
+public:
+    /**
+     * @brief Input capture configuration struct.
+     */
+    struct Config {
+        void (*init_function)();
+        TIM_HandleTypeDef* handle;
+        uint32_t           timer_channel;
+    };
+
+    /**
+     * @brief Construct a new InputCapture object.
+     *
+     * @param config Configuration for the input capture.
+     */
+    explicit InputCapture(const Config& config);
+
+    /**
+     * @brief Get the time since the last capture.
+     *
+     * @return Time since the last capture in seconds, valid while it is shorter than the timer period.
+     */
+    float get_capture_age() const;
+
+private:
+    /**
+     * @brief Timer handle.
+     */
+    TIM_HandleTypeDef* handle;
+
+    /**
+     * @brief Channel of the timer capturing the counter.
+     */
+    uint32_t timer_channel;
+
+    /**
+     * @brief Period of a timer count in seconds.
+     */
+    float count_period;
+};
+}  // namespace micras::hal
+
+#endif  // MICRAS_HAL_INPUT_CAPTURE_HPP
@@ -37,6 +37,13 @@ public:
      */
     void set_duty_cycle(float duty_cycle);
 
+    /**
+     * @brief Get the elapsed fraction of the current PWM period.
+     *
+     * @return Elapsed fraction of the period, from 0 to 1.
+     */
+    float get_period_phase() const;
+
     /**
      * @brief Set the PWM frequency.
      *
@@ -60,6 +60,22 @@ public:
      */
     void receive(std::span<uint8_t> data);
 
+    /**
+     * @brief Start a full-duplex transfer over SPI using DMA.
+     *
+     * @param tx_data Data to transmit.
+     * @param rx_data Buffer for the received data, with the same size as the transmitted data.
+     * @return True if the transfer was started, false otherwise.
+     */
+    bool transfer_dma(std::span<uint8_t> tx_data, std::span<uint8_t> rx_data);
+
+    /**
+     * @brief Check if the SPI is busy.
+     *
+     * @return True if a transfer is in progress, false otherwise.
+     */
+    bool is_busy() const;
+
 private:
     /**
      * @brief Handle for the SPI.
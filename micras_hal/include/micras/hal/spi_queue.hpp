@@ -0,0 +1,121 @@
+/**
+ * @file
+ */
+
+#ifndef MICRAS_HAL_SPI_QUEUE_HPP
+#define MICRAS_HAL_SPI_QUEUE_HPP
+
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <span>
+
+namespace micras::hal {
+template <typename T>
+concept SpiDevice = requires(T device, std::span<uint8_t> data) {
+    { device.select_device() } -> std::same_as<bool>;
+    { device.unselect_device() } -> std::same_as<void>;
+    { device.transfer_dma(data, data) } -> std::same_as<bool>;
+    { device.is_busy() } -> std::same_as<bool>;
+};
+
+/**
+ * @brief Queue of SPI transactions transferred using DMA.
+ *
+ * @tparam Device Type of the devices, selected by the chip select during their transactions.
+ * @tparam max_size Maximum number of pending transactions.
+ *
+ * @details The queue is processed by polling, so the callbacks run in the same context as the rest of the loop and
+ * can queue the transaction that depends on the received data, which is chained right after it.
+ */
+template <SpiDevice Device, uint8_t max_size>
+class TSpiQueue {
+public:
+    /**
+     * @brief Type to store a transaction.
+     */
+    struct Transaction {
+        /**
+         * @brief Device to select during the transaction.
+         */
+        Device* device;
+
+        /**
+         * @brief Data to transmit.
+         */
+        std::span<uint8_t> tx_data;
+
+        /**
+         * @brief Buffer for the received data, with the same size as the transmitted data.
+         */
+        std::span<uint8_t> rx_data;
+
+        /**
+         * @brief Function called when the transaction completes, if any.
+         */
+        void (*callback)(void* context, std::span<uint8_t> rx_data);
+
+        /**
+         * @brief Context passed to the callback.
+         */
+        void* context;
+    };
+
+    /**
+     * @brief Queue a transaction, starting it if the bus is free.
+     *
+     * @param transaction Transaction to queue.
+     * @return True if the transaction was queued, false if the queue is full.
+     */
+    bool push(const Transaction& transaction);
+
+    /**
+     * @brief Complete the current transaction if its transfer finished and start the next one.
+     */
+    void process();
+
+    /**
+     * @brief Check if all transactions were completed.
+     *
+     * @return True if there is no pending transaction, false otherwise.
+     */
+    bool is_idle() const;
+
+    /**
+     * @brief Get the number of pending transactions.
+     *
+     * @return Number of pending transactions, including the one being transferred.
+     */
+    uint8_t size() const;
+
+private:
+    /**
+     * @brief Start the transfer of the first pending transaction.
+     */
+    void start();
+
+    /**
+     * @brief Pending transactions.
+     */
+    std::array<Transaction, max_size> transactions{};
+
+    /**
+     * @brief Index of the first pending transaction.
+     */
+    uint8_t first{};
+
+    /**
+     * @brief Number of pending transactions.
+     */
+    uint8_t num_of_transactions{};
+
+    /**
+     * @brief Flag to check if the first transaction is being transferred.
+     */
+    bool transferring{};
+};
+}  // namespace micras::hal
+
+#include "../src/spi_queue.cpp"  // NOLINT(bugprone-suspicious-include, misc-header-include-cycle)
+
+#endif  // MICRAS_HAL_SPI_QUEUE_HPP
@@ -2,11 +2,18 @@
  * @file
  */
 
+#include <array>
 #include <bit>
 
 #include "micras/hal/adc_dma.hpp"
 
 namespace micras::hal {
+/**
+ * @brief Objects receiving the DMA interrupts of each ADC.
+ */
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+static std::array<AdcDma*, 5> transfer_handlers{};
+
 AdcDma::AdcDma(const Config& config) : max_reading{config.max_reading}, handle{config.handle} {
     config.init_function();
     HAL_ADCEx_Calibration_Start(this->handle, ADC_SINGLE_ENDED);
@@ -24,7 +31,46 @@ void AdcDma::stop_dma() {
     HAL_ADC_Stop_DMA(this->handle);
 }
 
+void AdcDma::set_transfer_callback(void (*callback)(void* context, uint8_t half), void* context) {
+    this->transfer_callback = callback;
+    this->transfer_context = context;
+
+    for (auto& handler : transfer_handlers) {
+        if (handler == nullptr or handler == this) {
+            handler = this;
+            return;
+        }
+    }
+}
+
+void AdcDma::process_transfer(ADC_HandleTypeDef* handle, uint8_t half) {
+    for (auto* handler : transfer_handlers) {
+        if (handler != nullptr and handler->handle == handle) {
+            handler->transfer_callback(handler->transfer_context, half);
+            return;
+        }
+    }
+}
+
 uint16_t AdcDma::get_max_reading() const {
     return this->max_reading;
 }
 }  // namespace micras::hal
+
+extern "C" {
+/**
+ * @brief Overrides of the HAL callbacks, called when each half of the DMA buffer of an ADC is filled.
+ *
+ * @param handle ADC handle.
+ */
+///@{
+void HAL_ADC_ConvHalfCpltCallback(ADC_HandleTypeDef* handle) {
+    micras::hal::AdcDma::process_transfer(handle, 0);
+}
+
+void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef* handle) {
+    micras::hal::AdcDma::process_transfer(handle, 1);
+}
+
+///@}
+}
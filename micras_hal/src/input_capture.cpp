@@ -0,0 +1,26 @@
+/**
+ * @file
+ */
+
+#include "micras/hal/input_capture.hpp"
+
+namespace micras::hal {
+InputCapture::InputCapture(const Config& config) : handle{config.handle}, timer_channel{config.timer_channel} {
+    config.init_function();
+    HAL_TIM_IC_Start(this->handle, this->timer_channel);
+
+    // NOLINTNEXTLINE(cppcoreguidelines-prefer-member-initializer)
+    this->count_period = (this->handle->Instance->PSC + 1.0F) / HAL_RCC_GetPCLK1Freq();
+}
+
+float InputCapture::get_capture_age() const {
+    const uint32_t counter = __HAL_TIM_GET_COUNTER(this->handle);
+    const uint32_t capture = HAL_TIM_ReadCapturedValue(this->handle, this->timer_channel);
+
+    // The counter may have rolled over since the capture, the subtraction must wrap at the auto reload value
+    const uint32_t counts =
+        counter >= capture ? counter - capture : counter + (__HAL_TIM_GET_AUTORELOAD(this->handle) - capture) + 1;
+
+    return counts * this->count_period;
+}
+}  // namespace micras::hal
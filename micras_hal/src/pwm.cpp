@@ -18,6 +18,10 @@ void Pwm::set_duty_cycle(float duty_cycle) {
     __HAL_TIM_SET_COMPARE(this->handle, this->channel, compare);
 }
 
+float Pwm::get_period_phase() const {
+    return static_cast<float>(__HAL_TIM_GET_COUNTER(this->handle)) / (__HAL_TIM_GET_AUTORELOAD(this->handle) + 1);
+}
+
 void Pwm::set_frequency(uint32_t frequency) {
     const uint32_t base_freq = HAL_RCC_GetPCLK1Freq();
     const uint32_t prescaler = this->handle->Instance->PSC;
@@ -29,4 +29,12 @@ void Spi::transmit(std::span<uint8_t> data) {
 void Spi::receive(std::span<uint8_t> data) {
     HAL_SPI_Receive(this->handle, data.data(), data.size(), this->timeout);
 }
+
+bool Spi::transfer_dma(std::span<uint8_t> tx_data, std::span<uint8_t> rx_data) {
+    return HAL_SPI_TransmitReceive_DMA(this->handle, tx_data.data(), rx_data.data(), tx_data.size()) == HAL_OK;
+}
+
+bool Spi::is_busy() const {
+    return HAL_SPI_GetState(this->handle) != HAL_SPI_STATE_READY;
+}
 }  // namespace micras::hal
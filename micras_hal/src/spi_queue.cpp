@@ -0,0 +1,83 @@
+/**
+ * @file
+ */
+
+#ifndef MICRAS_HAL_SPI_QUEUE_CPP
+#define MICRAS_HAL_SPI_QUEUE_CPP
+
+#include "micras/hal/spi_queue.hpp"
+
+namespace micras::hal {
+template <SpiDevice Device, uint8_t max_size>
+bool TSpiQueue<Device, max_size>::push(const Transaction& transaction) {
+    if (this->num_of_transactions == max_size) {
+        return false;
+    }
+
+    this->transactions.at((this->first + this->num_of_transactions) % max_size) = transaction;
+    this->num_of_transactions++;
+
+    if (not this->transferring) {
+        this->start();
+    }
+
+    return true;
+}
+
+template <SpiDevice Device, uint8_t max_size>
+void TSpiQueue<Device, max_size>::process() {
+    if (this->transferring) {
+        const Transaction transaction = this->transactions.at(this->first);
+
+        if (transaction.device->is_busy()) {
+            return;
+        }
+
+        transaction.device->unselect_device();
+        this->transferring = false;
+        this->first = (this->first + 1) % max_size;
+        this->num_of_transactions--;
+
+        if (transaction.callback != nullptr) {
+            transaction.callback(transaction.context, transaction.rx_data);
+        }
+    }
+
+    if (not this->transferring) {
+        this->start();
+    }
+}
+
+template <SpiDevice Device, uint8_t max_size>
+bool TSpiQueue<Device, max_size>::is_idle() const {
+    return this->num_of_transactions == 0;
+}
+
+template <SpiDevice Device, uint8_t max_size>
+uint8_t TSpiQueue<Device, max_size>::size() const {
+    return this->num_of_transactions;
+}
+
+template <SpiDevice Device, uint8_t max_size>
+void TSpiQueue<Device, max_size>::start() {
+    if (this->num_of_transactions == 0) {
+        return;
+    }
+
+    const Transaction& transaction = this->transactions.at(this->first);
+
+    // The bus may be in use by another device, in which case the transaction is started in a later call
+    if (not transaction.device->select_device()) {
+        return;
+    }
+
+    if (not transaction.device->transfer_dma(transaction.tx_data, transaction.rx_data)) {
+        transaction.device->unselect_device();
+        return;
+    }
+
+    this->transferring = true;
+}
+}  // namespace micras::hal
+
+#endif  // MICRAS_HAL_SPI_QUEUE_CPP
@@ -8,9 +8,16 @@
 #include <list>
 #include <memory>
 #include <queue>
+#include <span>
+#include <vector>
 
+#include "micras/nav/actions/curve.hpp"
 #include "micras/nav/actions/move.hpp"
+#include "micras/nav/actions/s_curve_move.hpp"
+#include "micras/nav/actions/tabulated.hpp"
+#include "micras/nav/actions/turn_back.hpp"
 #include "micras/nav/actions/turn.hpp"
+#include "micras/nav/turn_primitive.hpp"
 
 namespace micras::nav {
 /**
@@ -29,6 +36,7 @@ public:
         TURN_LEFT = 4,
         TURN_RIGHT = 5,
         TURN_BACK = 6,
+        MOVE_DIAGONAL = 7,
     };
 
     /**
@@ -39,17 +47,42 @@ public:
             float max_linear_speed;
             float max_linear_acceleration;
             float max_linear_deceleration;
+            float max_linear_jerk;
             float curve_radius;
             float max_centrifugal_acceleration;
             float max_angular_acceleration;
         };
 
-        float   cell_size;
-        float   start_offset;
-        Dynamic exploring;
-        Dynamic solving;
+        struct Turns {
+            TurnPrimitive::Config search_90;
+            TurnPrimitive::Config large_90;
+            TurnPrimitive::Config u_turn_180;
+            TurnPrimitive::Config in_45;
+            TurnPrimitive::Config out_45;
+            TurnPrimitive::Config in_135;
+            TurnPrimitive::Config out_135;
+            TurnPrimitive::Config v_90;
+        };
+
+        struct TurnBack {
+            float max_angular_speed;
+            float overlap_speed;
+            float launch_angle;
+        };
+
+        float    cell_size;
+        float    start_offset;
+        Dynamic  exploring;
+        Dynamic  solving;
+        Turns    turns;
+        TurnBack turn_back;
     };
 
+    /**
+     * @brief Number of samples in the speed profile tables of the queued actions.
+     */
+    static constexpr uint16_t profile_table_size{64};
+
     /**
      * @brief Construct a new ActionQueuer object.
      *
@@ -61,14 +94,14 @@ public:
      * @brief Push an action to the queue.
      *
      * @param current_pose Current pose of the robot.
-     * @param target_position Target position to move to.
+     * @param target_position Target position to move to, or the current position to stop at the center of the cell.
      */
     void push(const GridPose& current_pose, const GridPoint& target_position);
 
     /**
      * @brief Pop an action from the queue.
      *
-     * @return Shared pointer to the action.
+     * @return Shared pointer to the action, or nullptr if the queue is empty.
      */
     std::shared_ptr<Action> pop();
 
@@ -81,15 +114,157 @@ public:
 
     /**
      * @brief Fill the action queue with a sequence of actions to the end.
+     *
+     * @param best_route Route to the goal, starting at the start pose.
+     *
+     * @details The route is converted into solving actions: consecutive forward cells are merged into a single
+     * jerk limited straight, sequences of turns are replaced by the turn primitives that fit them, zigzags being run
+     * as diagonals, and the speeds between the actions are planned over the whole route, so the robot only brakes
+     * where the next turn or the end of the route requires it. A route without movements only queues the start
+     * action.
      */
     void recompute(const std::list<GridPose>& best_route);
 
+    /**
+     * @brief Fill the action queue with a turn back from rest at the center of a cell.
+     *
+     * @details The robot leaves towards the cell behind it, reaching its edge at the exploring speed, so the next
+     * exploring actions continue from there.
+     */
+    void recompute_turn_back();
+
 private:
+    /**
+     * @brief Segment of the solving route executed by a single action.
+     */
+    struct RouteSegment {
+        /**
+         * @brief ID of the action executing the segment.
+         */
+        uint8_t action_id;
+
+        /**
+         * @brief Length of the segment in meters, zero for turns.
+         */
+        float distance;
+
+        /**
+         * @brief Turn primitive of the segment, null for straights.
+         */
+        const TurnPrimitive* primitive;
+
+        /**
+         * @brief Whether the turn is to the left or to the right.
+         */
+        bool turning_left;
+
+        /**
+         * @brief Maximum linear speed along the segment in m/s.
+         */
+        float max_speed;
+
+        /**
+         * @brief Whether the robot can follow walls along the segment.
+         */
+        bool follow_wall;
+
+        /**
+         * @brief Distance from the start of the segment to the first cell edge in meters, for straights.
+         */
+        float cell_edge;
+    };
+
+    /**
+     * @brief Get the movements between the cells of a route.
+     *
+     * @param best_route Route to the goal, starting at the start pose.
+     * @return Direction of each movement, zero when moving forward, positive to the left and negative to the right.
+     */
+    static std::vector<int8_t> get_route_moves(const std::list<GridPose>& best_route);
+
+    /**
+     * @brief Split the movements of a route into straight and turn segments.
+     *
+     * @param moves Direction of each movement of the route.
+     * @param use_primitives Whether each sequence of turns can use the turn primitives or only the search turns.
+     * @return The segments of the route.
+     */
+    std::vector<RouteSegment> build_route_segments(
+        const std::vector<int8_t>& moves, const std::vector<bool>& use_primitives
+    ) const;
+
+    /**
+     * @brief Append the segments of a sequence of turns between two straights.
+     *
+     * @param segments Segments of the route built so far.
+     * @param straight Straight being built before the turns, replaced by the straight after them.
+     * @param turns Direction of each turn, positive to the left and negative to the right.
+     * @param use_primitives Whether the turns can use the turn primitives or only the search turns.
+     *
+     * @details A single turn is made as a large 90 and two turns to the same side as a 180. Longer sequences are run
+     * as a diagonal: the first and last turns become 45 or 135 turns into and out of it and two turns to the same side
+     * in the middle become a V90. The search turns are used when the turns do not fit any primitive.
+     */
+    void append_turns(
+        std::vector<RouteSegment>& segments, RouteSegment& straight, std::span<const int8_t> turns,
+        bool use_primitives
+    ) const;
+
+    /**
+     * @brief Append a turn primitive to the route, finishing the straight before it.
+     *
+     * @param segments Segments of the route built so far.
+     * @param straight Straight being built before the turn, replaced by the straight after it.
+     * @param primitive Turn primitive to append.
+     * @param turning_left Whether the turn is to the left or to the right.
+     * @param entry_leg Distance of the straight before the turn included in the primitive in meters.
+     * @param exit_leg Distance of the straight after the turn included in the primitive in meters.
+     * @param diagonal_exit Whether the straight after the turn is a diagonal.
+     */
+    void append_turn(
+        std::vector<RouteSegment>& segments, RouteSegment& straight, const TurnPrimitive& primitive, bool turning_left,
+        float entry_leg, float exit_leg, bool diagonal_exit
+    ) const;
+
+    /**
+     * @brief Plan the minimum time speeds between the segments of a route.
+     *
+     * @param segments Segments of the route.
+     * @return The speed at the start of each segment followed by the final speed, in m/s.
+     *
+     * @details The speeds start at the maximum speed of the neighbour segments. A forward pass limits them to what
+     * can be reached accelerating from the start of the route and a backward pass to what can still brake in time for
+     * the next segments. Turns keep a constant linear speed, so both of their ends share the same speed.
+     */
+    std::vector<float> plan_speeds(const std::vector<RouteSegment>& segments) const;
+
+    /**
+     * @brief Estimate the time to run the segments of a route with the planned speeds.
+     *
+     * @param segments Segments of the route.
+     * @return The duration of the route in seconds.
+     */
+    float estimate_duration(const std::vector<RouteSegment>& segments) const;
+
+    /**
+     * @brief Tabulated versions of the actions, evaluated without square roots while running.
+     */
+    ///@{
+    using TabulatedMoveAction = TTabulatedMoveAction<MoveAction, profile_table_size>;
+    using TabulatedSCurveMoveAction = TTabulatedMoveAction<SCurveMoveAction, profile_table_size>;
+    using TabulatedTurnAction = TTabulatedTurnAction<profile_table_size>;
+    ///@}
+
     /**
      * @brief Size of the cells in the grid.
      */
     float cell_size;
 
+    /**
+     * @brief Distance from the start cell back edge to the robot center when starting.
+     */
+    float start_offset;
+
     /**
      * @brief Dynamic exploring parameters.
      */
@@ -98,19 +273,33 @@ private:
     /**
      * @brief Dynamic solving parameters.
      */
-    // Config::Dynamic solving_params;
+    Config::Dynamic solving_params;
+
+    /**
+     * @brief Turn primitives used in the solving run.
+     */
+    ///@{
+    TurnPrimitive search_90;
+    TurnPrimitive large_90;
+    TurnPrimitive u_turn_180;
+    TurnPrimitive in_45;
+    TurnPrimitive out_45;
+    TurnPrimitive in_135;
+    TurnPrimitive out_135;
+    TurnPrimitive v_90;
+    ///@}
 
     /**
      * @brief Pre-built actions to use in the exploration.
      */
     ///@{
-    std::shared_ptr<MoveAction> stop;
-    std::shared_ptr<MoveAction> start;
-    std::shared_ptr<MoveAction> move_forward;
-    std::shared_ptr<MoveAction> move_half;
-    std::shared_ptr<TurnAction> turn_left;
-    std::shared_ptr<TurnAction> turn_right;
-    std::shared_ptr<TurnAction> turn_back;
+    std::shared_ptr<MoveAction>     start;
+    std::shared_ptr<MoveAction>     move_forward;
+    std::shared_ptr<MoveAction>     stop;
+    std::shared_ptr<TurnAction>     turn_left;
+    std::shared_ptr<TurnAction>     turn_right;
+    std::shared_ptr<TurnBackAction> turn_back;
+    std::shared_ptr<TurnBackAction> turn_back_from_rest;
     ///@}
 
     /**
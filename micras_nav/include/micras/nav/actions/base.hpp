@@ -5,6 +5,10 @@
 #ifndef MICRAS_NAV_BASE_ACTION_HPP
 #define MICRAS_NAV_BASE_ACTION_HPP
 
+#include <concepts>
+#include <cstdint>
+
+#include "micras/core/fastmath.hpp"
 #include "micras/nav/state.hpp"
 
 namespace micras::nav {
@@ -13,6 +17,21 @@ namespace micras::nav {
  */
 class Action {
 public:
+    /**
+     * @brief Type to store the result of a trajectory preview.
+     */
+    struct Trajectory {
+        /**
+         * @brief Time taken to finish the action in seconds.
+         */
+        float duration;
+
+        /**
+         * @brief Pose of the robot when the action finishes, relative to the start of the action.
+         */
+        Pose end_pose;
+    };
+
     /**
      * @brief Constructor for the Action class.
      *
@@ -48,6 +67,28 @@ public:
      */
     virtual bool allow_follow_wall() const = 0;
 
+    /**
+     * @brief Get the pose of the robot relative to the nominal end of the action.
+     *
+     * @param pose The current pose of the robot.
+     * @return The residual pose, in the frame where the next action starts.
+     *
+     * @details The next action starts from the residual pose instead of the current pose, so the distance and angle
+     * travelled past the end of an action are not lost between actions.
+     */
+    virtual Pose get_residual_pose(const Pose& pose) const = 0;
+
+    /**
+     * @brief Get the pose of the reference trajectory at the current progress of the action.
+     *
+     * @param pose The current pose of the robot.
+     * @return The reference pose, in the same frame as the current pose.
+     *
+     * @details The progress is measured from the current pose, so only the deviations across the trajectory and in
+     * heading are left to be corrected by a tracking controller.
+     */
+    virtual Pose get_reference_pose(const Pose& pose) const = 0;
+
     /**
      * @brief Get the ID of the action.
      *
@@ -55,6 +96,73 @@ public:
      */
     uint8_t get_id() const { return id; }
 
+    /**
+     * @brief Get the position along the action of one of the cell edges it crosses.
+     *
+     * @return The position of a cell edge along the x axis of the action in meters.
+     *
+     * @details The cell edges repeat every cell size, so this is enough to know where the posts are along straight
+     * actions.
+     */
+    float get_cell_edge() const { return cell_edge; }
+
+    /**
+     * @brief Set the position along the action of one of the cell edges it crosses.
+     *
+     * @param cell_edge The position of a cell edge along the x axis of the action in meters.
+     */
+    void set_cell_edge(float cell_edge) { this->cell_edge = cell_edge; }
+
+    /**
+     * @brief Preview the trajectory of the action assuming the desired speeds are followed perfectly.
+     *
+     * @tparam F Type of the sample callback.
+     * @param sample_time Time between two samples in seconds, usually the control loop period.
+     * @param on_sample Function called with the time and the desired speeds of each sample.
+     * @return The duration and end pose of the action.
+     *
+     * @details The action is simulated from rest at the origin in the same way it is executed by the control loop:
+     * the desired speeds are sampled from the current pose until the action is finished. Actions that would never
+     * finish are cut at the maximum preview duration.
+     */
+    template <std::invocable<float, const Twist&> F>
+    Trajectory preview(float sample_time, F on_sample) const {
+        Pose     pose{{0.0F, 0.0F}, 0.0F};
+        uint32_t num_of_samples = 0;
+
+        while (not this->finished(pose) and num_of_samples * sample_time < max_preview_duration) {
+            const Twist twist = this->get_speeds(pose);
+            on_sample(num_of_samples * sample_time, twist);
+
+            const float linear_distance = twist.linear * sample_time;
+            const float half_angle = twist.angular * sample_time / 2.0F;
+
+            const auto [sin, cos] = core::math::sincos(pose.orientation + half_angle);
+
+            pose.position.x += linear_distance * cos;
+            pose.position.y += linear_distance * sin;
+            pose.orientation += 2.0F * half_angle;
+            num_of_samples++;
+        }
+
+        return {.duration = num_of_samples * sample_time, .end_pose = pose};
+    }
+
+    /**
+     * @brief Preview the trajectory of the action assuming the desired speeds are followed perfectly.
+     *
+     * @param sample_time Time between two samples in seconds, usually the control loop period.
+     * @return The duration and end pose of the action.
+     */
+    Trajectory preview(float sample_time) const {
+        return this->preview(sample_time, [](float /*time*/, const Twist& /*twist*/) { });
+    }
+
+    /**
+     * @brief Maximum duration of a trajectory preview in seconds.
+     */
+    static constexpr float max_preview_duration{10.0F};
+
 protected:
     /**
      * @brief Special member functions declared as default.
@@ -71,6 +179,11 @@ private:
      * @brief The ID of the action.
      */
     uint8_t id;
+
+    /**
+     * @brief Position of a cell edge along the x axis of the action in meters.
+     */
+    float cell_edge{};
 };
 }  // namespace micras::nav
 
@@ -0,0 +1,131 @@
+/**
+ * @file
+ */
+
+#ifndef MICRAS_NAV_CURVE_ACTION_HPP
+#define MICRAS_NAV_CURVE_ACTION_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#include "micras/nav/actions/base.hpp"
+#include "micras/nav/turn_primitive.hpp"
+
+namespace micras::nav {
+/**
+ * @brief Action to make the curve of a turn primitive at a constant linear speed.
+ *
+ * @details The entry and exit offsets of the primitive are not part of the action, they are travelled by the
+ * neighbour straight actions.
+ */
+class CurveAction : public Action {
+public:
+    /**
+     * @brief Construct a new Curve Action object.
+     *
+     * @param action_id The ID of the action.
+     * @param primitive Geometry of the turn, which must outlive the action.
+     * @param turning_left Whether the robot turns to the left or to the right.
+     * @param linear_speed Linear speed in m/s.
+     */
+    CurveAction(uint8_t action_id, const TurnPrimitive& primitive, bool turning_left, float linear_speed) :
+        Action{action_id}, primitive{&primitive}, direction{turning_left ? 1.0F : -1.0F}, linear_speed{linear_speed} { }
+
+    /**
+     * @brief Get the desired speeds for the robot to complete the action.
+     *
+     * @param pose Current pose of the robot.
+     * @return The desired speeds for the robot to complete the action.
+     *
+     * @details The angular speed follows the curvature of the primitive at the turned angle.
+     */
+    Twist get_speeds(const Pose& pose) const override {
+        const float current_orientation = std::max(std::abs(pose.orientation), start_orientation);
+
+        return {
+            .linear = this->linear_speed,
+            .angular = this->direction * this->linear_speed * this->primitive->get_curvature(current_orientation),
+        };
+    }
+
+    /**
+     * @brief Check if the action is finished.
+     *
+     * @param pose Current pose of the robot.
+     * @return True if the action is finished, false otherwise.
+     */
+    bool finished(const Pose& pose) const override {
+        return std::abs(pose.orientation) >= this->primitive->get_angle();
+    }
+
+    /**
+     * @brief Check if the action allows following the wall.
+     *
+     * @return True if the action allows following the wall, false otherwise.
+     */
+    bool allow_follow_wall() const override { return false; }
+
+    /**
+     * @brief Get the pose of the robot relative to the nominal end of the action.
+     *
+     * @param pose Current pose of the robot.
+     * @return The residual pose, in the frame where the next action starts.
+     */
+    Pose get_residual_pose(const Pose& pose) const override {
+        const float        end_orientation = this->direction * this->primitive->get_angle();
+        const core::Vector end_position = this->mirror(this->primitive->get_position(this->primitive->get_angle()));
+        const core::Vector displacement = pose.position - end_position;
+        const float        end_cos = std::cos(end_orientation);
+        const float        end_sin = std::sin(end_orientation);
+
+        return {
+            {end_cos * displacement.x + end_sin * displacement.y, end_cos * displacement.y - end_sin * displacement.x},
+            pose.orientation - end_orientation
+        };
+    }
+
+    /**
+     * @brief Get the pose of the reference trajectory at the current progress of the action.
+     *
+     * @param pose Current pose of the robot.
+     * @return The pose on the curve at the angle turned by the robot.
+     */
+    Pose get_reference_pose(const Pose& pose) const override {
+        const float orientation = std::min(std::abs(pose.orientation), this->primitive->get_angle());
+
+        return {this->mirror(this->primitive->get_position(orientation)), this->direction * orientation};
+    }
+
+private:
+    /**
+     * @brief Mirror a position of a turn to the left to the direction of the action.
+     *
+     * @param position Position for a turn to the left.
+     * @return The position for the direction of the action.
+     */
+    core::Vector mirror(const core::Vector& position) const { return {position.x, this->direction * position.y}; }
+
+    /**
+     * @brief Start orientation in radians. Being zero causes the robot to not turn.
+     */
+    static constexpr float start_orientation{0.001F};
+
+    /**
+     * @brief Geometry of the turn.
+     */
+    const TurnPrimitive* primitive;
+
+    /**
+     * @brief Sign of the angular speed, positive when turning to the left.
+     */
+    float direction;
+
+    /**
+     * @brief Linear speed in m/s while turning.
+     */
+    float linear_speed;
+};
+}  // namespace micras::nav
+
+#endif  // MICRAS_NAV_CURVE_ACTION_HPP
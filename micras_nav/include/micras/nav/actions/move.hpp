@@ -53,7 +53,7 @@ public:
      * @details The desired velocity is calculated from the linear displacement based on the Torricelli equation.
      */
     Twist get_speeds(const Pose& pose) const override {
-        const float current_distance = pose.position.magnitude();
+        const float current_distance = pose.position.x;
         Twist       twist{};
 
         if (current_distance < this->decelerate_distance) {
@@ -80,7 +80,7 @@ public:
      * @param pose The current pose of the robot.
      * @return True if the action is finished, false otherwise.
      */
-    bool finished(const Pose& pose) const override { return pose.position.magnitude() >= this->distance; }
+    bool finished(const Pose& pose) const override { return pose.position.x >= this->distance; }
 
     /**
      * @brief Check if the action allows the robot to follow walls.
@@ -89,6 +89,31 @@ public:
      */
     bool allow_follow_wall() const override { return this->follow_wall; }
 
+    /**
+     * @brief Get the pose of the robot relative to the nominal end of the action.
+     *
+     * @param pose The current pose of the robot.
+     * @return The residual pose, in the frame where the next action starts.
+     *
+     * @details When following walls, only the distance travelled past the end is kept, since the heading is corrected
+     * by the walls and not by the action.
+     */
+    Pose get_residual_pose(const Pose& pose) const override {
+        if (this->follow_wall) {
+            return {{pose.position.x - this->distance, 0.0F}, 0.0F};
+        }
+
+        return {{pose.position.x - this->distance, pose.position.y}, pose.orientation};
+    }
+
+    /**
+     * @brief Get the pose of the reference trajectory at the current progress of the action.
+     *
+     * @param pose The current pose of the robot.
+     * @return The reference pose, on the straight line of the action.
+     */
+    Pose get_reference_pose(const Pose& pose) const override { return {{pose.position.x, 0.0F}, 0.0F}; }
+
 private:
     /**
      * @brief Distance to move in meters.
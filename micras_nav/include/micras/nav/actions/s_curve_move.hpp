@@ -0,0 +1,379 @@
+/**
+ * @file
+ */
+
+#ifndef MICRAS_NAV_S_CURVE_MOVE_ACTION_HPP
+#define MICRAS_NAV_S_CURVE_MOVE_ACTION_HPP
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+
+#include "micras/nav/actions/base.hpp"
+
+namespace micras::nav {
+/**
+ * @brief Action to move the robot a certain distance forward with a jerk limited speed profile.
+ *
+ * @details The profile is made of seven segments of constant jerk: the acceleration ramps up, stays constant and
+ * ramps down until the peak speed is reached, the robot cruises and the deceleration follows the same shape.
+ * Since the acceleration is continuous, the wheels are not excited by the steps of a trapezoidal profile.
+ * If the distance is too short to reach the final speed, the profile is truncated at the distance.
+ */
+class SCurveMoveAction : public Action {
+public:
+    /**
+     * @brief Construct a new S-Curve Move Action object.
+     *
+     * @param action_id The ID of the action.
+     * @param distance Distance to move in meters.
+     * @param start_speed Initial speed in m/s.
+     * @param end_speed Final speed in m/s.
+     * @param max_speed Maximum speed in m/s.
+     * @param max_acceleration Maximum acceleration in m/s^2.
+     * @param max_deceleration Maximum deceleration in m/s^2.
+     * @param max_jerk Maximum jerk in m/s^3.
+     * @param follow_wall Whether the robot can follow wall while executing this action.
+     */
+    SCurveMoveAction(
+        uint8_t action_id, float distance, float start_speed, float end_speed, float max_speed, float max_acceleration,
+        float max_deceleration, float max_jerk, bool follow_wall = true
+    ) :
+        Action{action_id}, distance{distance}, follow_wall{follow_wall} {
+        const auto profile_distance = [&](float peak_speed) {
+            return speed_change_distance(start_speed, peak_speed, max_acceleration, max_jerk) +
+                   speed_change_distance(peak_speed, end_speed, max_deceleration, max_jerk);
+        };
+
+        float peak_speed = max_speed;
+
+        if (profile_distance(max_speed) > distance) {
+            float low_speed = std::min(std::max(start_speed, end_speed), max_speed);
+            float high_speed = max_speed;
+
+            for (uint8_t i = 0; i < peak_search_iterations; i++) {
+                peak_speed = (low_speed + high_speed) / 2.0F;
+
+                if (profile_distance(peak_speed) > distance) {
+                    high_speed = peak_speed;
+                } else {
+                    low_speed = peak_speed;
+                }
+            }
+
+            peak_speed = low_speed;
+        }
+
+        const float cruise_distance = std::max(distance - profile_distance(peak_speed), 0.0F);
+
+        this->add_speed_change(0, start_speed, peak_speed, max_acceleration, max_jerk);
+        this->segments[3].duration = peak_speed > 0.0F ? cruise_distance / peak_speed : 0.0F;
+        this->add_speed_change(4, peak_speed, end_speed, max_deceleration, max_jerk);
+
+        this->segments[0].start_speed = start_speed;
+
+        for (uint8_t i = 1; i < num_of_segments; i++) {
+            const Segment& previous = this->segments[i - 1];
+            Segment&       current = this->segments[i];
+
+            current.start_time = previous.start_time + previous.duration;
+            current.start_distance = previous.start_distance + previous.distance_at(previous.duration);
+            current.start_speed = previous.speed_at(previous.duration);
+            current.start_acceleration = previous.acceleration_at(previous.duration);
+        }
+    }
+
+    /**
+     * @brief Get the desired speeds for the robot to complete the action.
+     *
+     * @param pose The current pose of the robot.
+     * @return The desired speeds for the robot to complete the action.
+     *
+     * @details The desired velocity is sampled from the profile at the linear displacement of the robot. It never drops
+     * below a minimum speed, otherwise the robot would approach the end of a profile that stops at rest without ever
+     * reaching it.
+     */
+    Twist get_speeds(const Pose& pose) const override {
+        return {
+            .linear = std::max(this->get_speed_at_distance(pose.position.x), min_speed),
+            .angular = 0.0F,
+        };
+    }
+
+    /**
+     * @brief Check if the action is finished.
+     *
+     * @param pose The current pose of the robot.
+     * @return True if the action is finished, false otherwise.
+     */
+    bool finished(const Pose& pose) const override { return pose.position.x >= this->distance; }
+
+    /**
+     * @brief Check if the action allows the robot to follow walls.
+     *
+     * @return True if the action allows the robot to follow walls, false otherwise.
+     */
+    bool allow_follow_wall() const override { return this->follow_wall; }
+
+    /**
+     * @brief Get the pose of the robot relative to the nominal end of the action.
+     *
+     * @param pose The current pose of the robot.
+     * @return The residual pose, in the frame where the next action starts.
+     *
+     * @details When following walls, only the distance travelled past the end is kept, since the heading is corrected
+     * by the walls and not by the action.
+     */
+    Pose get_residual_pose(const Pose& pose) const override {
+        if (this->follow_wall) {
+            return {{pose.position.x - this->distance, 0.0F}, 0.0F};
+        }
+
+        return {{pose.position.x - this->distance, pose.position.y}, pose.orientation};
+    }
+
+    /**
+     * @brief Get the pose of the reference trajectory at the current progress of the action.
+     *
+     * @param pose The current pose of the robot.
+     * @return The reference pose, on the straight line of the action.
+     */
+    Pose get_reference_pose(const Pose& pose) const override { return {{pose.position.x, 0.0F}, 0.0F}; }
+
+    /**
+     * @brief Sample the speed profile at a distance from the start.
+     *
+     * @param current_distance Distance from the start of the action in meters.
+     * @return The desired linear speed in m/s.
+     */
+    float get_speed_at_distance(float current_distance) const {
+        if (current_distance <= 0.0F) {
+            return this->segments[0].start_speed;
+        }
+
+        uint8_t index = num_of_segments - 1;
+
+        while (index > 0 and this->segments[index].start_distance > current_distance) {
+            index--;
+        }
+
+        const Segment& segment = this->segments[index];
+        const float    segment_distance = current_distance - segment.start_distance;
+
+        if (segment_distance >= segment.distance_at(segment.duration)) {
+            return segment.speed_at(segment.duration);
+        }
+
+        float time = segment.duration * segment_distance / segment.distance_at(segment.duration);
+
+        for (uint8_t i = 0; i < time_search_iterations; i++) {
+            const float speed = std::max(segment.speed_at(time), min_speed);
+            time = std::clamp(time - (segment.distance_at(time) - segment_distance) / speed, 0.0F, segment.duration);
+        }
+
+        return segment.speed_at(time);
+    }
+
+    /**
+     * @brief Sample the speed profile at a time from the start.
+     *
+     * @param time Time since the start of the action in seconds.
+     * @return The desired linear speed in m/s.
+     */
+    float get_speed_at_time(float time) const {
+        if (time <= 0.0F) {
+            return this->segments[0].start_speed;
+        }
+
+        uint8_t index = num_of_segments - 1;
+
+        while (index > 0 and this->segments[index].start_time > time) {
+            index--;
+        }
+
+        const Segment& segment = this->segments[index];
+
+        return segment.speed_at(std::min(time - segment.start_time, segment.duration));
+    }
+
+    /**
+     * @brief Get the total duration of the speed profile.
+     *
+     * @return The duration of the profile in seconds.
+     */
+    float get_duration() const {
+        const Segment& last_segment = this->segments[num_of_segments - 1];
+        return last_segment.start_time + last_segment.duration;
+    }
+
+    /**
+     * @brief Calculate the highest speed that can be reached from a speed within a distance.
+     *
+     * @param from_speed Initial speed in m/s.
+     * @param distance Distance available to change the speed in meters.
+     * @param max_speed Maximum speed in m/s.
+     * @param max_acceleration Maximum acceleration in m/s^2.
+     * @param max_jerk Maximum jerk in m/s^3.
+     * @return The reachable speed in m/s.
+     *
+     * @details As the speed change is symmetric, this is also the highest speed from which the robot can brake to the
+     * initial speed within the distance, using the maximum deceleration instead.
+     */
+    static float max_reachable_speed(
+        float from_speed, float distance, float max_speed, float max_acceleration, float max_jerk
+    ) {
+        if (speed_change_distance(from_speed, max_speed, max_acceleration, max_jerk) <= distance) {
+            return max_speed;
+        }
+
+        float low_speed = from_speed;
+        float high_speed = max_speed;
+
+        for (uint8_t i = 0; i < peak_search_iterations; i++) {
+            const float speed = (low_speed + high_speed) / 2.0F;
+
+            if (speed_change_distance(from_speed, speed, max_acceleration, max_jerk) > distance) {
+                high_speed = speed;
+            } else {
+                low_speed = speed;
+            }
+        }
+
+        return low_speed;
+    }
+
+private:
+    /**
+     * @brief Segment of the profile with constant jerk.
+     */
+    struct Segment {
+        /**
+         * @brief Calculate the speed at a time from the start of the segment.
+         *
+         * @param time Time since the start of the segment in seconds.
+         * @return The speed in m/s.
+         */
+        float speed_at(float time) const {
+            return this->start_speed + time * (this->start_acceleration + time * this->jerk / 2.0F);
+        }
+
+        /**
+         * @brief Calculate the acceleration at a time from the start of the segment.
+         *
+         * @param time Time since the start of the segment in seconds.
+         * @return The acceleration in m/s^2.
+         */
+        float acceleration_at(float time) const { return this->start_acceleration + this->jerk * time; }
+
+        /**
+         * @brief Calculate the distance travelled at a time from the start of the segment.
+         *
+         * @param time Time since the start of the segment in seconds.
+         * @return The distance in meters.
+         */
+        float distance_at(float time) const {
+            return time * (this->start_speed + time * (this->start_acceleration / 2.0F + time * this->jerk / 6.0F));
+        }
+
+        float duration{};
+        float jerk{};
+        float start_time{};
+        float start_distance{};
+        float start_speed{};
+        float start_acceleration{};
+    };
+
+    /**
+     * @brief Calculate the distance needed to change between two speeds.
+     *
+     * @param from_speed Initial speed in m/s.
+     * @param to_speed Final speed in m/s.
+     * @param max_acceleration Maximum acceleration in m/s^2.
+     * @param max_jerk Maximum jerk in m/s^3.
+     * @return The distance in meters.
+     *
+     * @details As the acceleration profile is symmetric, the mean speed is the average of the two speeds.
+     */
+    static float speed_change_distance(float from_speed, float to_speed, float max_acceleration, float max_jerk) {
+        const auto [jerk_time, acceleration_time] =
+            speed_change_times(std::abs(to_speed - from_speed), max_acceleration, max_jerk);
+        return (from_speed + to_speed) * (jerk_time + acceleration_time / 2.0F);
+    }
+
+    /**
+     * @brief Calculate the duration of the jerk and constant acceleration phases of a speed change.
+     *
+     * @param speed_change Absolute speed change in m/s.
+     * @param max_acceleration Maximum acceleration in m/s^2.
+     * @param max_jerk Maximum jerk in m/s^3.
+     * @return The duration of each jerk phase and of the constant acceleration phase in seconds.
+     */
+    static std::pair<float, float> speed_change_times(float speed_change, float max_acceleration, float max_jerk) {
+        if (speed_change * max_jerk >= max_acceleration * max_acceleration) {
+            return {max_acceleration / max_jerk, speed_change / max_acceleration - max_acceleration / max_jerk};
+        }
+
+        return {std::sqrt(speed_change / max_jerk), 0.0F};
+    }
+
+    /**
+     * @brief Fill three segments with a jerk limited speed change.
+     *
+     * @param first_index Index of the first segment.
+     * @param from_speed Initial speed in m/s.
+     * @param to_speed Final speed in m/s.
+     * @param max_acceleration Maximum acceleration in m/s^2.
+     * @param max_jerk Maximum jerk in m/s^3.
+     */
+    void add_speed_change(
+        uint8_t first_index, float from_speed, float to_speed, float max_acceleration, float max_jerk
+    ) {
+        const auto [jerk_time, acceleration_time] =
+            speed_change_times(std::abs(to_speed - from_speed), max_acceleration, max_jerk);
+        const float jerk = std::copysign(max_jerk, to_speed - from_speed);
+
+        this->segments[first_index] = {.duration = jerk_time, .jerk = jerk};
+        this->segments[first_index + 1] = {.duration = acceleration_time, .jerk = 0.0F};
+        this->segments[first_index + 2] = {.duration = jerk_time, .jerk = -jerk};
+    }
+
+    /**
+     * @brief Number of segments of the profile.
+     */
+    static constexpr uint8_t num_of_segments{7};
+
+    /**
+     * @brief Number of bisection iterations used to find the peak speed.
+     */
+    static constexpr uint8_t peak_search_iterations{16};
+
+    /**
+     * @brief Number of Newton iterations used to find the time at a given distance.
+     */
+    static constexpr uint8_t time_search_iterations{3};
+
+    /**
+     * @brief Minimum speed of the robot and of the Newton iterations, avoiding divisions by zero, in m/s.
+     */
+    static constexpr float min_speed{0.001F};
+
+    /**
+     * @brief Distance to move in meters.
+     */
+    float distance;
+
+    /**
+     * @brief Whether the robot can follow walls while executing this action.
+     */
+    bool follow_wall;
+
+    /**
+     * @brief Constant jerk segments of the profile.
+     */
+    std::array<Segment, num_of_segments> segments{};
+};
+}  // namespace micras::nav
+
+#endif  // MICRAS_NAV_S_CURVE_MOVE_ACTION_HPP
@@ -0,0 +1,159 @@
+/**
+ * @file
+ */
+
+#ifndef MICRAS_NAV_TABULATED_ACTION_HPP
+#define MICRAS_NAV_TABULATED_ACTION_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#include "micras/core/lookup_table.hpp"
+#include "micras/nav/actions/turn.hpp"
+
+namespace micras::nav {
+/**
+ * @brief Move action that samples its speed profile in a table when it is built.
+ *
+ * @tparam T Type of the move action being tabulated.
+ * @tparam table_size Number of samples of the speed versus distance table.
+ *
+ * @details The profile of the base action is only evaluated in the constructor, so no square roots are needed while
+ * the action runs, only a linear interpolation between two samples. The first and last intervals of the table are
+ * still evaluated by the base action, since the profiles are too steep near zero speed to be interpolated and the
+ * robot would take much longer to leave or reach rest.
+ */
+template <typename T, uint16_t table_size>
+class TTabulatedMoveAction : public T {
+public:
+    /**
+     * @brief Construct a new Tabulated Move Action object.
+     *
+     * @tparam Args Types of the remaining arguments of the base action.
+     * @param action_id The ID of the action.
+     * @param distance Distance to move in meters.
+     * @param args Remaining arguments of the base action constructor.
+     */
+    template <typename... Args>
+    TTabulatedMoveAction(uint8_t action_id, float distance, Args... args) :
+        T{action_id, distance, args...},
+        start_distance{distance / (table_size - 1)},
+        end_distance{distance - start_distance},
+        speed_table{0.0F, distance, [this](float current_distance) {
+                        return T::get_speeds({{current_distance, 0.0F}, 0.0F}).linear;
+                    }} { }
+
+    /**
+     * @brief Get the desired speeds for the robot to complete the action.
+     *
+     * @param pose The current pose of the robot.
+     * @return The desired speeds for the robot to complete the action.
+     */
+    Twist get_speeds(const Pose& pose) const override {
+        const float current_distance = pose.position.x;
+
+        if (current_distance < this->start_distance or current_distance > this->end_distance) {
+            return T::get_speeds(pose);
+        }
+
+        return {
+            .linear = this->speed_table.interpolate(current_distance),
+            .angular = 0.0F,
+        };
+    }
+
+private:
+    /**
+     * @brief Distance where the interpolation starts in meters.
+     */
+    float start_distance;
+
+    /**
+     * @brief Distance where the interpolation ends in meters.
+     */
+    float end_distance;
+
+    /**
+     * @brief Linear speed versus travelled distance.
+     */
+    core::TLookupTable<table_size> speed_table;
+};
+
+/**
+ * @brief Turn action that samples its angular speed profile in a table when it is built.
+ *
+ * @tparam table_size Number of samples of the angular speed versus angle table.
+ *
+ * @details As in the move action, the first and last intervals of the table are evaluated by the base action.
+ */
+template <uint16_t table_size>
+class TTabulatedTurnAction : public TurnAction {
+public:
+    /**
+     * @brief Construct a new Tabulated Turn Action object.
+     *
+     * @param action_id The ID of the action.
+     * @param angle Angle to turn in radians.
+     * @param curve_radius Radius of the curve in meters.
+     * @param linear_speed Linear speed in m/s.
+     * @param max_angular_acceleration Maximum angular acceleration in rad/s^2.
+     */
+    TTabulatedTurnAction(
+        uint8_t action_id, float angle, float curve_radius, float linear_speed, float max_angular_acceleration
+    ) :
+        TurnAction{action_id, angle, curve_radius, linear_speed, max_angular_acceleration},
+        linear_speed{linear_speed},
+        start_orientation{std::abs(angle) / (table_size - 1)},
+        end_orientation{std::abs(angle) - start_orientation},
+        angular_speed_table{0.0F, std::abs(angle), [this, angle](float orientation) {
+                                // The base profile drops to zero once the turn is finished, so the last sample is
+                                // taken right before the end of the turn
+                                const float last_orientation = std::nextafter(std::abs(angle), 0.0F);
+                                return TurnAction::get_speeds({{0.0F, 0.0F}, std::min(orientation, last_orientation)})
+                                    .angular;
+                            }} { }
+
+    /**
+     * @brief Get the desired speeds for the robot to complete the action.
+     *
+     * @param pose Current pose of the robot.
+     * @return The desired speeds for the robot to complete the action.
+     */
+    Twist get_speeds(const Pose& pose) const override {
+        const float current_orientation = std::abs(pose.orientation);
+
+        if (current_orientation < this->start_orientation or current_orientation > this->end_orientation) {
+            return TurnAction::get_speeds(pose);
+        }
+
+        return {
+            .linear = this->linear_speed,
+            .angular = this->angular_speed_table.interpolate(current_orientation),
+        };
+    }
+
+private:
+    /**
+     * @brief Linear speed in m/s while turning.
+     */
+    float linear_speed;
+
+    /**
+     * @brief Orientation where the interpolation starts in radians.
+     */
+    float start_orientation;
+
+    /**
+     * @brief Orientation where the interpolation ends in radians.
+     */
+    float end_orientation;
+
+    /**
+     * @brief Signed angular speed versus absolute turned angle.
+     */
+    core::TLookupTable<table_size> angular_speed_table;
+};
+}  // namespace micras::nav
+
+#endif  // MICRAS_NAV_TABULATED_ACTION_HPP
@@ -85,6 +85,22 @@ public:
      */
     bool allow_follow_wall() const override { return false; }
 
+    /**
+     * @brief Get the pose of the robot relative to the nominal end of the action.
+     *
+     * @param pose Current pose of the robot.
+     * @return The residual pose, in the frame where the next action starts.
+     */
+    Pose get_residual_pose(const Pose& pose) const override { return {{0.0F, 0.0F}, pose.orientation - this->angle}; }
+
+    /**
+     * @brief Get the pose of the reference trajectory at the current progress of the action.
+     *
+     * @param pose Current pose of the robot.
+     * @return The current pose, since the trajectory of the turn is only defined by its speeds.
+     */
+    Pose get_reference_pose(const Pose& pose) const override { return pose; }
+
 private:
     /**
      * @brief Calculate the maximum angular speed for a given curve radius and linear speed.
@@ -0,0 +1,212 @@
+/**
+ * @file
+ */
+
+#ifndef MICRAS_NAV_TURN_BACK_ACTION_HPP
+#define MICRAS_NAV_TURN_BACK_ACTION_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+
+#include "micras/nav/actions/base.hpp"
+
+namespace micras::nav {
+/**
+ * @brief Action to stop, turn back in place and leave in the opposite direction as a single movement.
+ *
+ * @details The rotation starts while the robot is still braking and the robot starts to accelerate while the rotation
+ * is still finishing, so the three phases overlap instead of each one waiting for the previous one to come to rest.
+ * The linear speeds are calculated from the advance of the robot along its initial orientation, which can be
+ * corrected by a front wall to stop at the right distance from it.
+ */
+class TurnBackAction : public Action {
+public:
+    /**
+     * @brief Construct a new Turn Back Action object.
+     *
+     * @param action_id The ID of the action.
+     * @param stop_distance Distance to move forward before turning in meters.
+     * @param launch_distance Distance to move back after turning in meters.
+     * @param start_speed Initial linear speed in m/s.
+     * @param end_speed Final linear speed in m/s.
+     * @param max_acceleration Maximum linear acceleration in m/s^2.
+     * @param max_deceleration Maximum linear deceleration in m/s^2.
+     * @param max_angular_speed Maximum angular speed in rad/s.
+     * @param max_angular_acceleration Maximum angular acceleration in rad/s^2.
+     * @param overlap_speed Linear speed below which the rotation starts while braking in m/s.
+     * @param launch_angle Remaining angle to turn when the robot starts to accelerate in radians.
+     */
+    TurnBackAction(
+        uint8_t action_id, float stop_distance, float launch_distance, float start_speed, float end_speed,
+        float max_acceleration, float max_deceleration, float max_angular_speed, float max_angular_acceleration,
+        float overlap_speed, float launch_angle
+    ) :
+        Action{action_id},
+        stop_distance{stop_distance},
+        launch_distance{launch_distance},
+        start_speed{start_speed},
+        end_speed{end_speed},
+        max_acceleration_doubled{2.0F * max_acceleration},
+        max_deceleration_doubled{2.0F * max_deceleration},
+        max_angular_speed{max_angular_speed},
+        max_angular_acceleration_doubled{2.0F * max_angular_acceleration},
+        overlap_distance{overlap_speed * overlap_speed / max_deceleration_doubled},
+        launch_orientation{std::numbers::pi_v<float> - launch_angle},
+        min_launch_speed_2{std::pow(0.001F * max_acceleration, 2.0F)} { }
+
+    /**
+     * @brief Get the desired speeds for the robot to complete the action.
+     *
+     * @param pose The current pose of the robot.
+     * @return The desired speeds for the robot to complete the action.
+     *
+     * @details The linear speed follows the Torricelli equation while braking to the stop point and accelerating away
+     * from it, and the angular speed follows it on the turned angle.
+     */
+    Twist get_speeds(const Pose& pose) const override {
+        const float remaining_distance = this->stop_distance - pose.position.x;
+        const float turned = std::abs(pose.orientation);
+        Twist       twist{};
+
+        // Once the robot faces backwards, moving forward would increase the remaining distance instead of reducing it
+        if (turned < std::numbers::pi_v<float> / 2.0F) {
+            twist.linear = std::fminf(
+                this->start_speed, std::sqrt(this->max_deceleration_doubled * std::max(remaining_distance, 0.0F))
+            );
+        } else if (turned >= this->launch_orientation) {
+            const float launch_distance = std::max(remaining_distance, 0.0F);
+
+            twist.linear = std::fminf(
+                this->end_speed, std::sqrt(this->min_launch_speed_2 + this->max_acceleration_doubled * launch_distance)
+            );
+        }
+
+        // The orientation is never exactly zero when the action starts, so it can only tell the rotation already
+        // started once the robot turned sideways, when it stops approaching the stop point
+        if (remaining_distance <= this->overlap_distance or turned >= std::numbers::pi_v<float> / 2.0F) {
+            const float start_turned = std::max(turned, TurnBackAction::start_orientation);
+
+            twist.angular = std::fminf(
+                this->max_angular_speed,
+                std::sqrt(
+                    this->max_angular_acceleration_doubled *
+                    std::fminf(start_turned, std::max(std::numbers::pi_v<float> - turned, 0.0F))
+                )
+            );
+        }
+
+        return twist;
+    }
+
+    /**
+     * @brief Check if the action is finished.
+     *
+     * @param pose The current pose of the robot.
+     * @return True if the action is finished, false otherwise.
+     */
+    bool finished(const Pose& pose) const override {
+        return std::abs(pose.orientation) >= std::numbers::pi_v<float> and
+               this->stop_distance - pose.position.x >= this->launch_distance;
+    }
+
+    /**
+     * @brief Check if the action allows the robot to follow walls.
+     *
+     * @return True if the action allows the robot to follow walls, false otherwise.
+     */
+    bool allow_follow_wall() const override { return false; }
+
+    /**
+     * @brief Get the pose of the robot relative to the nominal end of the action.
+     *
+     * @param pose The current pose of the robot.
+     * @return The residual pose, in the frame where the next action starts.
+     */
+    Pose get_residual_pose(const Pose& pose) const override {
+        return {
+            {this->stop_distance - pose.position.x - this->launch_distance, 0.0F},
+            pose.orientation - std::numbers::pi_v<float>
+        };
+    }
+
+    /**
+     * @brief Get the pose of the reference trajectory at the current progress of the action.
+     *
+     * @param pose The current pose of the robot.
+     * @return The current pose, since the trajectory of the turn is only defined by its speeds.
+     */
+    Pose get_reference_pose(const Pose& pose) const override { return pose; }
+
+    /**
+     * @brief Get the distance to move forward before turning.
+     *
+     * @return The stop distance in meters.
+     */
+    float get_stop_distance() const { return this->stop_distance; }
+
+private:
+    /**
+     * @brief Start orientation in radians. Being zero causes the robot to not turn.
+     */
+    static constexpr float start_orientation{0.001F};
+
+    /**
+     * @brief Distance to move forward before turning in meters.
+     */
+    float stop_distance;
+
+    /**
+     * @brief Distance to move back after turning in meters.
+     */
+    float launch_distance;
+
+    /**
+     * @brief Initial linear speed in m/s.
+     */
+    float start_speed;
+
+    /**
+     * @brief Final linear speed in m/s.
+     */
+    float end_speed;
+
+    /**
+     * @brief Maximum linear acceleration multiplied by 2.
+     */
+    float max_acceleration_doubled;
+
+    /**
+     * @brief Maximum linear deceleration multiplied by 2.
+     */
+    float max_deceleration_doubled;
+
+    /**
+     * @brief Maximum angular speed in rad/s.
+     */
+    float max_angular_speed;
+
+    /**
+     * @brief Maximum angular acceleration multiplied by 2.
+     */
+    float max_angular_acceleration_doubled;
+
+    /**
+     * @brief Remaining braking distance when the rotation starts in meters.
+     */
+    float overlap_distance;
+
+    /**
+     * @brief Turned angle from which the robot starts to accelerate in radians.
+     */
+    float launch_orientation;
+
+    /**
+     * @brief Square of the linear speed when the robot starts to accelerate.
+     */
+    float min_launch_speed_2;
+};
+}  // namespace micras::nav
+
+#endif  // MICRAS_NAV_TURN_BACK_ACTION_HPP
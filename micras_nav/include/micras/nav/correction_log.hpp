@@ -0,0 +1,129 @@
+/**
+ * @file
+ */
+
+#ifndef MICRAS_NAV_CORRECTION_LOG_HPP
+#define MICRAS_NAV_CORRECTION_LOG_HPP
+
+#include <array>
+#include <cstdint>
+
+namespace micras::nav {
+/**
+ * @brief Circular log of the position corrections applied to the odometry.
+ *
+ * @tparam max_size Number of corrections kept in the log.
+ *
+ * @details Besides the last corrections, the number of corrections and the sum of their squared errors are kept for
+ * each source, so the accuracy of the odometry can be compared between runs.
+ */
+template <uint16_t max_size>
+class TCorrectionLog {
+public:
+    /**
+     * @brief Sources of the corrections.
+     */
+    enum Source : uint8_t {
+        POST = 0,
+        FRONT_WALL = 1,
+    };
+
+    /**
+     * @brief Type to store a correction.
+     */
+    struct Entry {
+        /**
+         * @brief Source of the correction.
+         */
+        Source source;
+
+        /**
+         * @brief ID of the action being executed.
+         */
+        uint8_t action_id;
+
+        /**
+         * @brief Measured advance of the robot along the action in meters.
+         */
+        float advance;
+
+        /**
+         * @brief Difference between the measured and the estimated advance in meters.
+         */
+        float error;
+    };
+
+    /**
+     * @brief Record a correction.
+     *
+     * @param entry The correction to record.
+     */
+    void record(const Entry& entry);
+
+    /**
+     * @brief Get a recorded correction.
+     *
+     * @param index Index of the correction, starting from the oldest one kept.
+     * @return The correction at the index.
+     */
+    const Entry& get(uint16_t index) const;
+
+    /**
+     * @brief Get the number of corrections kept in the log.
+     *
+     * @return The number of corrections kept.
+     */
+    uint16_t size() const;
+
+    /**
+     * @brief Get the number of corrections recorded from a source.
+     *
+     * @param source The source of the corrections.
+     * @return The number of corrections since the log was cleared.
+     */
+    uint32_t get_count(Source source) const;
+
+    /**
+     * @brief Get the root mean square error of the corrections from a source.
+     *
+     * @param source The source of the corrections.
+     * @return The root mean square error in meters.
+     */
+    float get_rms_error(Source source) const;
+
+    /**
+     * @brief Clear the log.
+     */
+    void clear();
+
+private:
+    /**
+     * @brief Number of sources of corrections.
+     */
+    static constexpr uint8_t num_of_sources{2};
+
+    /**
+     * @brief Last corrections recorded.
+     */
+    std::array<Entry, max_size> entries{};
+
+    /**
+     * @brief Total number of corrections recorded.
+     */
+    uint32_t num_of_entries{};
+
+    /**
+     * @brief Number of corrections recorded from each source.
+     */
+    std::array<uint32_t, num_of_sources> counts{};
+
+    /**
+     * @brief Sum of the squared errors of the corrections from each source.
+     */
+    std::array<float, num_of_sources> squared_error_sums{};
+};
+}  // namespace micras::nav
+
+#include "../src/correction_log.cpp"  // NOLINT(bugprone-suspicious-include, misc-header-include-cycle)
+
+#endif  // MICRAS_NAV_CORRECTION_LOG_HPP
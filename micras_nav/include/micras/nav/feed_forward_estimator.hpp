@@ -0,0 +1,196 @@
+/**
+ * @file
+ */
+
+#ifndef MICRAS_NAV_FEED_FORWARD_ESTIMATOR_HPP
+#define MICRAS_NAV_FEED_FORWARD_ESTIMATOR_HPP
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "micras/core/biquad_filter_bank.hpp"
+#include "micras/core/recursive_least_squares.hpp"
+#include "micras/core/serializable.hpp"
+#include "micras/nav/speed_controller.hpp"
+#include "micras/nav/state.hpp"
+
+namespace micras::nav {
+/**
+ * @brief Class to identify the feed-forward gains of each wheel while the robot runs.
+ *
+ * @details The command of each wheel is modeled as the feed-forward of the measured speeds and accelerations, and its
+ * gains are estimated by recursive least squares. The commands and the speeds go through the same low-pass filter, so
+ * the model still holds between the filtered signals while the accelerations are derived without the noise of the
+ * speeds. Samples with the robot stopped or with a saturated command do not follow the model, so they are skipped. The
+ * estimated gains only replace the accepted ones while they are within the sanity bounds, and the accepted gains are
+ * serialized to keep them between runs.
+ */
+class FeedForwardEstimator : public core::ISerializable {
+public:
+    /**
+     * @brief Type to store the feed-forward gains of a wheel.
+     */
+    using FeedForward = SpeedController::Config::FeedForward;
+
+    /**
+     * @brief Configuration struct for the feed-forward estimator.
+     */
+    struct Config {
+        core::TRecursiveLeastSquares<4, 2>::Config estimator;
+        core::FilterDesign                         filter;
+        float                                      min_linear_speed{};
+        float                                      min_angular_speed{};
+        float                                      max_command{};
+        uint32_t                                   min_num_of_samples{};
+        FeedForward                                min_gains{};
+        FeedForward                                max_gains{};
+    };
+
+    /**
+     * @brief Construct a new Feed Forward Estimator object.
+     *
+     * @param config Configuration for the feed-forward estimator.
+     * @param left_feed_forward Initial feed-forward gains of the left wheel.
+     * @param right_feed_forward Initial feed-forward gains of the right wheel.
+     */
+    FeedForwardEstimator(
+        const Config& config, const FeedForward& left_feed_forward, const FeedForward& right_feed_forward
+    );
+
+    /**
+     * @brief Update the estimate with the commands sent to the wheels and the resulting speeds.
+     *
+     * @param velocity Measured speeds of the robot.
+     * @param left_command Command sent to the left wheel.
+     * @param right_command Command sent to the right wheel.
+     * @param elapsed_time Time since the last update.
+     */
+    void update(const Twist& velocity, float left_command, float right_command, float elapsed_time);
+
+    /**
+     * @brief Get the accepted feed-forward gains of the left wheel.
+     *
+     * @return Feed-forward gains within the sanity bounds.
+     */
+    const FeedForward& get_left_feed_forward() const;
+
+    /**
+     * @brief Get the accepted feed-forward gains of the right wheel.
+     *
+     * @return Feed-forward gains within the sanity bounds.
+     */
+    const FeedForward& get_right_feed_forward() const;
+
+    /**
+     * @brief Restart the filters, keeping the estimate.
+     */
+    void reset();
+
+    /**
+     * @brief Serialize the accepted feed-forward gains.
+     *
+     * @return Serialized data.
+     */
+    std::vector<uint8_t> serialize() const override;
+
+    /**
+     * @brief Deserialize the accepted feed-forward gains, restarting the estimate from them.
+     *
+     * @param buffer Serialized data.
+     * @param size Size of the serialized data.
+     */
+    void deserialize(const uint8_t* buffer, uint16_t size) override;
+
+private:
+    /**
+     * @brief Index of each filtered signal.
+     */
+    enum Signal : uint8_t {
+        LEFT_COMMAND = 0,
+        RIGHT_COMMAND = 1,
+        LINEAR_SPEED = 2,
+        ANGULAR_SPEED = 3,
+    };
+
+    /**
+     * @brief Convert the gains of a wheel to the parameters of its model.
+     *
+     * @param feed_forward Feed-forward gains of the wheel.
+     * @return Parameters of the model.
+     */
+    static std::array<float, 4> to_parameters(const FeedForward& feed_forward);
+
+    /**
+     * @brief Convert the parameters of the model of a wheel to its gains.
+     *
+     * @param parameters Parameters of the model.
+     * @return Feed-forward gains of the wheel.
+     */
+    static FeedForward to_feed_forward(const std::array<float, 4>& parameters);
+
+    /**
+     * @brief Check whether the gains of a wheel are within the sanity bounds.
+     *
+     * @param feed_forward Feed-forward gains of the wheel.
+     * @return True if every gain is within its bounds, false otherwise.
+     */
+    bool is_within_bounds(const FeedForward& feed_forward) const;
+
+    /**
+     * @brief Recursive least squares estimator of the gains of both wheels.
+     */
+    core::TRecursiveLeastSquares<4, 2> estimator;
+
+    /**
+     * @brief Low-pass filters of the commands and the speeds.
+     */
+    core::TBiquadFilterBank<4> filter;
+
+    /**
+     * @brief Minimum speeds of the robot for a sample to be used.
+     */
+    ///@{
+    float min_linear_speed;
+    float min_angular_speed;
+    ///@}
+
+    /**
+     * @brief Maximum command of a wheel for a sample to be used.
+     */
+    float max_command;
+
+    /**
+     * @brief Minimum number of samples for the estimated gains to be accepted.
+     */
+    uint32_t min_num_of_samples;
+
+    /**
+     * @brief Sanity bounds of the gains.
+     */
+    ///@{
+    FeedForward min_gains;
+    FeedForward max_gains;
+    ///@}
+
+    /**
+     * @brief Accepted feed-forward gains of each wheel.
+     */
+    ///@{
+    FeedForward left_feed_forward;
+    FeedForward right_feed_forward;
+    ///@}
+
+    /**
+     * @brief Filtered speeds of the last update, to derive the accelerations.
+     */
+    Twist last_velocity{};
+
+    /**
+     * @brief Whether the filtered speeds of the last update are set.
+     */
+    bool has_last_velocity{false};
+};
+}  // namespace micras::nav
+
+#endif  // MICRAS_NAV_FEED_FORWARD_ESTIMATOR_HPP
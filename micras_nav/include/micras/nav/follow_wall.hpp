@@ -15,6 +15,11 @@
 namespace micras::nav {
 /**
  * @brief Class to follow the side walls using a PID controller.
+ *
+ * @details The lateral offset from the center of the corridor is measured from the distances to the side walls. The
+ * heading relative to the corridor is the change of the lateral offset over a window of travelled distance, carried
+ * forward by the rotation measured by the odometry until the next window. The controller steers the robot towards the
+ * center of the corridor at a lookahead distance, so it is damped by the heading.
  */
 class FollowWall {
 public:
@@ -28,6 +33,8 @@ public:
         float                       post_threshold{};
         float                       cell_size{};
         float                       post_clearance{};
+        float                       heading_window{};
+        float                       heading_lookahead{};
     };
 
     /**
@@ -57,6 +64,72 @@ public:
      */
     core::Observation get_observation() const;
 
+    /**
+     * @brief Check if the robot reached the front wall calibration distance.
+     *
+     * @return True if both front sensors see a wall at least as close as when calibrated, false otherwise.
+     */
+    bool reached_front_wall() const;
+
+    /**
+     * @brief Check if there is any side wall being followed.
+     *
+     * @return True if the robot is following the left or the right wall, false otherwise.
+     */
+    bool is_following_walls() const;
+
+    /**
+     * @brief Check if the robot saw a post in the last update.
+     *
+     * @return True if a side wall ended in the last call to compute_angular_correction, false otherwise.
+     */
+    bool saw_post() const;
+
+    /**
+     * @brief Get the distance travelled since the last post seen, when it was seen.
+     *
+     * @return Delay of the wall sensor filters in meters when the post was detected.
+     */
+    float get_post_lag() const;
+
+    /**
+     * @brief Get the lateral offset of the robot from the center of the corridor.
+     *
+     * @return The lateral offset in meters, positive to the left.
+     */
+    float get_lateral_offset() const;
+
+    /**
+     * @brief Get the heading of the robot relative to the corridor.
+     *
+     * @return The heading in radians, positive to the left.
+     */
+    float get_heading() const;
+
+    /**
+     * @brief Check if the heading was estimated from a new window in the last update.
+     *
+     * @return True if a window of travelled distance was completed in the last update, false otherwise.
+     */
+    bool has_new_estimate() const;
+
+    /**
+     * @brief Get the pose of the robot relative to the start of the current heading window.
+     *
+     * @return Pose travelled in the current heading window.
+     */
+    Pose get_window_pose() const;
+
+    /**
+     * @brief Continue the current heading window from the corrected odometry pose.
+     *
+     * @param window_pose Pose travelled in the window before the odometry was corrected.
+     *
+     * @details The corrections move the odometry pose without any motion of the robot, so the window must be
+     * re-referenced after them to not take the correction as travelled distance or rotation.
+     */
+    void continue_window(const Pose& window_pose);
+
     /**
      * @brief Reset the PID controller and the relative pose.
      */
@@ -80,6 +153,23 @@ private:
      */
     bool check_posts();
 
+    /**
+     * @brief Update the lateral offset and the heading estimates from the side walls being followed.
+     */
+    void update_estimate();
+
+    /**
+     * @brief Start a new heading window, discarding the current heading estimate.
+     */
+    void restart_estimate();
+
+    /**
+     * @brief Calculate the lateral offset from the side walls being followed.
+     *
+     * @return The lateral offset in meters, positive to the left.
+     */
+    float compute_lateral_offset() const;
+
     /**
      * @brief Wall sensors of the robot.
      */
@@ -149,6 +239,56 @@ private:
      * @brief Flag to indicate if relative pose was reset by a post.
      */
     bool reset_by_post{};
+
+    /**
+     * @brief Flag to indicate if a post was seen in the last update.
+     */
+    bool post_seen{};
+
+    /**
+     * @brief Distance travelled since the last post seen, when it was seen.
+     */
+    float post_lag{};
+
+    /**
+     * @brief Length of travelled distance used to estimate the heading.
+     */
+    float heading_window;
+
+    /**
+     * @brief Distance ahead of the robot at which it steers to the center of the corridor.
+     */
+    float heading_lookahead;
+
+    /**
+     * @brief Pose of the robot relative to the start of the current heading window.
+     */
+    RelativePose window_pose;
+
+    /**
+     * @brief Lateral offset at the start of the current heading window.
+     */
+    float window_lateral_offset{};
+
+    /**
+     * @brief Current lateral offset from the center of the corridor.
+     */
+    float lateral_offset{};
+
+    /**
+     * @brief Heading relative to the corridor at the start of the current heading window.
+     */
+    float window_heading{};
+
+    /**
+     * @brief Flag to indicate if the heading was estimated since the walls started being followed.
+     */
+    bool heading_estimated{};
+
+    /**
+     * @brief Flag to indicate if a heading window was completed in the last update.
+     */
+    bool new_estimate{};
 };
 }  // namespace micras::nav
 
@@ -5,9 +5,15 @@
 #ifndef MICRAS_NAV_ODOMETRY_HPP
 #define MICRAS_NAV_ODOMETRY_HPP
 
+#include <cstdint>
 #include <memory>
 
 #include "micras/core/butterworth_filter.hpp"
+#include "micras/core/encoder_velocity_estimator.hpp"
+#include "micras/core/gyro_bias_estimator.hpp"
+#include "micras/core/vector.hpp"
+#include "micras/core/velocity_observer.hpp"
+#include "micras/nav/pose_kalman_filter.hpp"
 #include "micras/nav/state.hpp"
 #include "micras/proxy/imu.hpp"
 #include "micras/proxy/rotary_sensor.hpp"
@@ -18,13 +24,38 @@ namespace micras::nav {
  */
 class Odometry {
 public:
+    /**
+     * @brief Enum for the linear velocity estimators.
+     */
+    enum LinearEstimator : uint8_t {
+        BUTTERWORTH = 0,
+        OBSERVER = 1,
+        EDGE_PERIOD = 2,
+    };
+
+    /**
+     * @brief Enum for the pose estimators.
+     */
+    enum PoseEstimator : uint8_t {
+        DEAD_RECKONING = 0,
+        KALMAN_FILTER = 1,
+    };
+
     /**
      * @brief Configuration for the odometry.
      */
     struct Config {
-        float linear_cutoff_frequency;
-        float wheel_radius;
-        Pose  initial_pose;
+        PoseEstimator                          pose_estimator;
+        LinearEstimator                        linear_estimator;
+        float                                  linear_cutoff_frequency;
+        core::VelocityObserver::Config         linear_observer;
+        core::EncoderVelocityEstimator::Config wheel_velocity;
+        PoseKalmanFilter::Config               kalman_filter;
+        float                                  position_deviation;
+        float                                  orientation_deviation;
+        core::GyroBiasEstimator::Config        gyro_bias;
+        float                                  wheel_radius;
+        Pose                                   initial_pose;
     };
 
     /**
@@ -45,8 +76,47 @@ public:
      * @brief Update the odometry.
      *
      * @param elapsed_time Time since the last update.
+     * @param linear_acceleration Commanded linear acceleration since the last update, used by the observer.
+     *
+     * @details With the Kalman filter, the encoders, the gyroscope and the accelerometer are fused into the state
+     * instead, and the linear estimator is not used. The encoder speed is always measured from the edge periods of the
+     * wheels, blended with the count difference at high speed.
+     */
+    void update(float elapsed_time, float linear_acceleration = 0.0F);
+
+    /**
+     * @brief Update the gyroscope bias whenever the robot stands still.
+     *
+     * @param elapsed_time Time since the last update.
+     *
+     * @details This should be called every loop, including while waiting, so the bias is estimated in every stop. The
+     * bias estimated by the Kalman filter is shifted by each change of the bias removed by the IMU, so its heading does
+     * not drift while the filter converges again.
+     */
+    void update_gyro_bias(float elapsed_time);
+
+    /**
+     * @brief Correct the position with a measurement along a direction.
+     *
+     * @param direction Unit vector of the measured direction.
+     * @param position Measured projection of the position on the direction in meters.
+     * @param deviation Standard deviation of the measurement in meters.
+     *
+     * @details With dead reckoning, the position is moved towards the measurement along the direction, weighted by
+     * the fixed deviation of the position against the deviation of the measurement.
+     */
+    void correct_position(const core::Vector& direction, float position, float deviation);
+
+    /**
+     * @brief Correct the orientation with a measurement.
+     *
+     * @param orientation Measured orientation in radians, unwrapped around the current orientation.
+     * @param deviation Standard deviation of the measurement in radians.
+     *
+     * @details With dead reckoning, the orientation is moved towards the measurement, weighted by the fixed deviation
+     * of the orientation against the deviation of the measurement.
      */
-    void update(float elapsed_time);
+    void correct_orientation(float orientation, float deviation);
 
     /**
      * @brief Reset the odometry.
@@ -98,11 +168,54 @@ private:
      */
     float right_last_position{};
 
+    /**
+     * @brief Estimator used for the pose.
+     */
+    PoseEstimator pose_estimator;
+
+    /**
+     * @brief Estimator used for the linear velocity.
+     */
+    LinearEstimator linear_estimator;
+
     /**
      * @brief Linear velocity filter.
      */
     core::ButterworthFilter linear_filter;
 
+    /**
+     * @brief Linear velocity observer.
+     */
+    core::VelocityObserver linear_observer;
+
+    /**
+     * @brief Left wheel velocity estimator.
+     */
+    core::EncoderVelocityEstimator left_velocity_estimator;
+
+    /**
+     * @brief Right wheel velocity estimator.
+     */
+    core::EncoderVelocityEstimator right_velocity_estimator;
+
+    /**
+     * @brief Variances assumed for the dead reckoning pose when it is corrected.
+     */
+    ///@{
+    float position_variance;
+    float orientation_variance;
+    ///@}
+
+    /**
+     * @brief Kalman filter fusing the sensors into the state.
+     */
+    PoseKalmanFilter kalman_filter;
+
+    /**
+     * @brief Estimator of the gyroscope bias.
+     */
+    core::GyroBiasEstimator gyro_bias_estimator;
+
     /**
      * @brief Current state of the robot in space.
      */
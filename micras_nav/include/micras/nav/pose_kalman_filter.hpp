@@ -0,0 +1,191 @@
+/**
+ * @file
+ */
+
+#ifndef MICRAS_NAV_POSE_KALMAN_FILTER_HPP
+#define MICRAS_NAV_POSE_KALMAN_FILTER_HPP
+
+#include <array>
+#include <cstdint>
+
+#include "micras/core/vector.hpp"
+#include "micras/nav/state.hpp"
+
+namespace micras::nav {
+/**
+ * @brief Extended Kalman filter estimating the pose, the speeds and the gyroscope bias of the robot.
+ *
+ * @details The state is the position, the orientation, the linear and angular speeds and the bias of the gyroscope.
+ * The prediction integrates the speeds over the arc of the last sample and uses the accelerometer as the input of the
+ * linear speed. The encoders and the gyroscope are fused as measurements of the speeds every sample, while the wall
+ * sensors give sporadic measurements of the position along a direction and of the orientation.
+ *
+ * Every measurement is scalar, so the corrections need no matrix inversion and the whole update takes a few
+ * microseconds, well inside the control loop.
+ */
+class PoseKalmanFilter {
+public:
+    /**
+     * @brief Configuration struct for the PoseKalmanFilter class.
+     */
+    struct Config {
+        float linear_acceleration_noise;
+        float angular_acceleration_noise;
+        float gyro_bias_drift;
+        float encoder_noise;
+        float gyro_noise;
+        float initial_gyro_bias_deviation;
+    };
+
+    /**
+     * @brief Construct a new Pose Kalman Filter object.
+     *
+     * @param config Configuration for the filter.
+     * @param initial_pose Initial pose of the robot.
+     */
+    PoseKalmanFilter(const Config& config, const Pose& initial_pose);
+
+    /**
+     * @brief Predict the state after a sample.
+     *
+     * @param linear_acceleration Linear acceleration measured by the accelerometer in m/s^2.
+     * @param elapsed_time Time since the last prediction in seconds.
+     */
+    void predict(float linear_acceleration, float elapsed_time);
+
+    /**
+     * @brief Correct the state with the linear speed measured by the encoders.
+     *
+     * @param linear_speed Measured linear speed in m/s.
+     */
+    void update_linear_speed(float linear_speed);
+
+    /**
+     * @brief Correct the state with the angular speed measured by the gyroscope, which includes its bias.
+     *
+     * @param angular_speed Measured angular speed in rad/s.
+     */
+    void update_angular_speed(float angular_speed);
+
+    /**
+     * @brief Correct the state with a measurement of the position along a direction.
+     *
+     * @param direction Unit vector of the measured direction.
+     * @param position Measured projection of the position on the direction in meters.
+     * @param deviation Standard deviation of the measurement in meters.
+     */
+    void correct_position(const core::Vector& direction, float position, float deviation);
+
+    /**
+     * @brief Correct the state with a measurement of the orientation.
+     *
+     * @param orientation Measured orientation in radians, unwrapped around the current estimate.
+     * @param deviation Standard deviation of the measurement in radians.
+     */
+    void correct_orientation(float orientation, float deviation);
+
+    /**
+     * @brief Reset the state to rest at a pose.
+     *
+     * @param pose Pose of the robot.
+     *
+     * @details The gyroscope bias estimate is kept, since it does not change when the robot is moved by hand.
+     */
+    void reset(const Pose& pose);
+
+    /**
+     * @brief Get the estimated state of the robot.
+     *
+     * @return The estimated pose and speeds.
+     */
+    State get_state() const;
+
+    /**
+     * @brief Get the estimated bias of the gyroscope.
+     *
+     * @return The gyroscope bias in rad/s.
+     */
+    float get_gyro_bias() const;
+
+    /**
+     * @brief Shift the estimated bias of the gyroscope, keeping its variance.
+     *
+     * @param offset Change of the bias in rad/s, like when the bias removed from the measurements changes.
+     */
+    void shift_gyro_bias(float offset);
+
+private:
+    /**
+     * @brief Indexes of the variables in the state vector.
+     */
+    enum Index : uint8_t {
+        POSITION_X = 0,
+        POSITION_Y = 1,
+        ORIENTATION = 2,
+        LINEAR_SPEED = 3,
+        ANGULAR_SPEED = 4,
+        GYRO_BIAS = 5,
+    };
+
+    /**
+     * @brief Number of variables in the state vector.
+     */
+    static constexpr uint8_t size{6};
+
+    /**
+     * @brief Type of the state vector.
+     */
+    using Vector = std::array<float, size>;
+
+    /**
+     * @brief Type of the covariance matrix.
+     */
+    using Matrix = std::array<Vector, size>;
+
+    /**
+     * @brief Correct the state with a scalar measurement.
+     *
+     * @param observation Row of the observation matrix.
+     * @param residual Difference between the measured and the predicted values.
+     * @param variance Variance of the measurement.
+     */
+    void correct(const Vector& observation, float residual, float variance);
+
+    /**
+     * @brief Variance of the accelerometer as an input of the linear speed in (m/s^2)^2.
+     */
+    float linear_acceleration_variance;
+
+    /**
+     * @brief Variance of the unmodelled angular acceleration in (rad/s^2)^2.
+     */
+    float angular_acceleration_variance;
+
+    /**
+     * @brief Variance of the gyroscope bias random walk in (rad/s)^2/s.
+     */
+    float gyro_bias_drift_variance;
+
+    /**
+     * @brief Variance of the linear speed measured by the encoders in (m/s)^2.
+     */
+    float encoder_variance;
+
+    /**
+     * @brief Variance of the angular speed measured by the gyroscope in (rad/s)^2.
+     */
+    float gyro_variance;
+
+    /**
+     * @brief Estimated state vector.
+     */
+    Vector state{};
+
+    /**
+     * @brief Covariance of the estimated state.
+     */
+    Matrix covariance{};
+};
+}  // namespace micras::nav
+
+#endif  // MICRAS_NAV_POSE_KALMAN_FILTER_HPP
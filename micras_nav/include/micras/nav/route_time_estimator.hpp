@@ -0,0 +1,73 @@
+/**
+ * @file
+ */
+
+#ifndef MICRAS_NAV_ROUTE_TIME_ESTIMATOR_HPP
+#define MICRAS_NAV_ROUTE_TIME_ESTIMATOR_HPP
+
+#include <cstdint>
+#include <list>
+
+#include "micras/nav/action_queuer.hpp"
+#include "micras/nav/grid_pose.hpp"
+#include "micras/nav/maze.hpp"
+
+namespace micras::nav {
+/**
+ * @brief Class to predict the time the robot takes to run a route without driving it.
+ */
+class RouteTimeEstimator {
+public:
+    /**
+     * @brief Configuration struct for the RouteTimeEstimator class.
+     */
+    struct Config {
+        float sample_time;
+    };
+
+    /**
+     * @brief Construct a new RouteTimeEstimator object.
+     *
+     * @param action_queuer_config Configuration of the action queuer used to build the route actions.
+     * @param config Configuration for the RouteTimeEstimator.
+     */
+    RouteTimeEstimator(const ActionQueuer::Config& action_queuer_config, Config config);
+
+    /**
+     * @brief Estimate the time to run a route.
+     *
+     * @param route Route to the goal, starting at the start pose.
+     * @return The predicted run time in seconds.
+     *
+     * @details The route is converted into the same actions queued for the solving run and the trajectory of each
+     * one is previewed in sequence, as the control loop executes them.
+     */
+    float estimate(const std::list<GridPose>& route);
+
+    /**
+     * @brief Estimate the time to run the best route of a maze.
+     *
+     * @tparam width The width of the maze.
+     * @tparam height The height of the maze.
+     * @param maze Maze with the best route already computed.
+     * @return The predicted run time in seconds.
+     */
+    template <uint8_t width, uint8_t height>
+    float estimate(const TMaze<width, height>& maze) {
+        return this->estimate(maze.get_best_route());
+    }
+
+private:
+    /**
+     * @brief Action queuer used to convert routes into actions.
+     */
+    ActionQueuer action_queuer;
+
+    /**
+     * @brief Time between two samples of the previews in seconds.
+     */
+    float sample_time;
+};
+}  // namespace micras::nav
+
+#endif  // MICRAS_NAV_ROUTE_TIME_ESTIMATOR_HPP
@@ -5,9 +5,10 @@
 #ifndef MICRAS_NAV_SPEED_CONTROLLER_HPP
 #define MICRAS_NAV_SPEED_CONTROLLER_HPP
 
+#include <cstdint>
 #include <utility>
 
-#include "micras/core/pid_controller.hpp"
+#include "micras/core/pid_controller_bank.hpp"
 #include "micras/nav/state.hpp"
 
 namespace micras::nav {
@@ -16,6 +17,11 @@ namespace micras::nav {
  */
 class SpeedController {
 public:
+    /**
+     * @brief Bank with the linear and angular PID controllers.
+     */
+    using PidBank = core::TPidControllerBank<2>;
+
     /**
      * @brief Configuration struct for the SpeedController class.
      */
@@ -27,12 +33,12 @@ public:
             float angular_acceleration;
         };
 
-        float                       max_linear_acceleration{};
-        float                       max_angular_acceleration{};
-        core::PidController::Config linear_pid;
-        core::PidController::Config angular_pid;
-        FeedForward                 left_feed_forward{};
-        FeedForward                 right_feed_forward{};
+        float           max_linear_acceleration{};
+        float           max_angular_acceleration{};
+        PidBank::Config linear_pid;
+        PidBank::Config angular_pid;
+        FeedForward     left_feed_forward{};
+        FeedForward     right_feed_forward{};
     };
 
     /**
@@ -63,7 +69,33 @@ public:
     std::pair<float, float> compute_feed_forward_commands(const Twist& desired_twist, float elapsed_time);
 
     /**
-     * @brief Reset the PID controllers.
+     * @brief Get the accelerations used in the last feed-forward commands.
+     *
+     * @return The last desired accelerations of the robot.
+     */
+    const Twist& get_last_acceleration() const;
+
+    /**
+     * @brief Set the feed-forward gains of the motors.
+     *
+     * @param left_feed_forward The feed-forward parameters for the left motor.
+     * @param right_feed_forward The feed-forward parameters for the right motor.
+     */
+    void set_feed_forward(const Config::FeedForward& left_feed_forward, const Config::FeedForward& right_feed_forward);
+
+    /**
+     * @brief Set a function to be called with the terms of the PID controllers on each update.
+     *
+     * @param callback Function called with the context and the terms, or nullptr to stop calling it.
+     * @param context Context passed to the callback.
+     */
+    void set_telemetry_callback(void (*callback)(void* context, const PidBank::Telemetry& telemetry), void* context);
+
+    /**
+     * @brief Reset the PID controllers and the last desired speeds.
+     *
+     * @details The state is kept between actions so the control stays continuous, it is only reset when the robot
+     * starts from rest.
      */
     void reset();
 
@@ -99,14 +131,22 @@ private:
     float last_angular_speed{};
 
     /**
-     * @brief PID controller for stopping at the goal.
+     * @brief The last desired accelerations of the robot.
      */
-    core::PidController linear_pid;
+    Twist last_acceleration{};
+
+    /**
+     * @brief Index of each controller in the PID bank.
+     */
+    enum Pid : uint8_t {
+        LINEAR = 0,
+        ANGULAR = 1,
+    };
 
     /**
-     * @brief PID controller for the orientation.
+     * @brief PID controllers of the linear and angular speeds.
      */
-    core::PidController angular_pid;
+    PidBank pid_bank;
 
     /**
      * @brief Feed-forward parameters for the left motor.
@@ -82,7 +82,7 @@ public:
     /**
      * @brief Get the relative pose.
      *
-     * @return The pose relative to the reference.
+     * @return The pose relative to the reference, with the x axis along the reference orientation.
      */
     Pose get() const;
 
@@ -91,6 +91,28 @@ public:
      */
     void reset_reference();
 
+    /**
+     * @brief Move the reference so the relative pose continues from a residual pose.
+     *
+     * @param residual_pose Pose the robot must have relative to the new reference.
+     */
+    void continue_reference(const Pose& residual_pose);
+
+    /**
+     * @brief Get the direction of the x axis of the reference.
+     *
+     * @return Unit vector along the reference orientation in absolute coordinates.
+     */
+    core::Vector get_direction() const;
+
+    /**
+     * @brief Convert a position relative to the reference to absolute coordinates.
+     *
+     * @param relative_position Position relative to the reference.
+     * @return The absolute position.
+     */
+    core::Vector to_absolute(const core::Vector& relative_position) const;
+
 private:
     /**
      * @brief A reference to the absolute pose.
@@ -101,6 +123,16 @@ private:
      * @brief The reference pose to be used for calculations.
      */
     Pose reference_pose{};
+
+    /**
+     * @brief Cosine of the reference orientation.
+     */
+    float reference_cos{1.0F};
+
+    /**
+     * @brief Sine of the reference orientation.
+     */
+    float reference_sin{0.0F};
 };
 }  // namespace micras::nav
 
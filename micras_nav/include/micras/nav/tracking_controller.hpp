@@ -0,0 +1,65 @@
+/**
+ * @file
+ */
+
+#ifndef MICRAS_NAV_TRACKING_CONTROLLER_HPP
+#define MICRAS_NAV_TRACKING_CONTROLLER_HPP
+
+#include "micras/nav/state.hpp"
+
+namespace micras::nav {
+/**
+ * @brief Class to correct the desired speeds so the robot follows a reference pose trajectory.
+ *
+ * @details Implements the Kanayama tracking law. The pose error is expressed in the frame of the robot and the
+ * reference speeds are corrected proportionally to the error along the trajectory, across it and in heading. The
+ * lateral and heading corrections are scaled by the reference linear speed, so the response is the same along the
+ * trajectory at any speed and there is no correction when turning in place.
+ */
+class TrackingController {
+public:
+    /**
+     * @brief Configuration struct for the TrackingController class.
+     */
+    struct Config {
+        float along_gain;
+        float lateral_gain;
+        float heading_gain;
+    };
+
+    /**
+     * @brief Construct a new TrackingController object.
+     *
+     * @param config Configuration for the TrackingController.
+     */
+    explicit TrackingController(const Config& config);
+
+    /**
+     * @brief Calculate the speeds to follow the reference trajectory.
+     *
+     * @param pose Current pose of the robot.
+     * @param reference_pose Pose of the reference trajectory.
+     * @param reference_twist Speeds of the reference trajectory.
+     * @return The corrected desired speeds.
+     */
+    Twist compute_speeds(const Pose& pose, const Pose& reference_pose, const Twist& reference_twist) const;
+
+private:
+    /**
+     * @brief Gain of the error along the trajectory in 1/s.
+     */
+    float along_gain;
+
+    /**
+     * @brief Gain of the error across the trajectory in 1/m^2.
+     */
+    float lateral_gain;
+
+    /**
+     * @brief Gain of the heading error in 1/m.
+     */
+    float heading_gain;
+};
+}  // namespace micras::nav
+
+#endif  // MICRAS_NAV_TRACKING_CONTROLLER_HPP
@@ -0,0 +1,174 @@
+/**
+ * @file
+ */
+
+#ifndef MICRAS_NAV_TURN_PRIMITIVE_HPP
+#define MICRAS_NAV_TURN_PRIMITIVE_HPP
+
+#include <cstdint>
+
+#include "micras/core/lookup_table.hpp"
+#include "micras/core/vector.hpp"
+
+namespace micras::nav {
+/**
+ * @brief Geometry of a smooth turn made of a clothoid, a circular arc and another clothoid.
+ *
+ * @details In the clothoids the curvature changes linearly with the travelled distance, so the angular speed ramps
+ * up and down smoothly while the linear speed is kept constant. The turn connects two straight lines of the maze,
+ * given by the displacement between a reference point on each of them. The radius is chosen as large as possible
+ * while still fitting between the two points, and the remaining distance is left as straight entry and exit offsets.
+ */
+class TurnPrimitive {
+public:
+    /**
+     * @brief Configuration struct for the TurnPrimitive class.
+     */
+    struct Config {
+        float        angle;
+        float        ramp_ratio;
+        core::Vector displacement;
+    };
+
+    /**
+     * @brief Construct a new TurnPrimitive object.
+     *
+     * @param config Configuration for the TurnPrimitive, for a turn to the left.
+     */
+    explicit TurnPrimitive(const Config& config);
+
+    /**
+     * @brief Get the curvature of the turn after turning an angle.
+     *
+     * @param orientation Absolute angle turned since the start of the curve in radians.
+     * @return The curvature in 1/m.
+     */
+    float get_curvature(float orientation) const;
+
+    /**
+     * @brief Get the position on the curve after turning an angle.
+     *
+     * @param orientation Absolute angle turned since the start of the curve in radians.
+     * @return The position relative to the start of the curve, for a turn to the left.
+     */
+    core::Vector get_position(float orientation) const;
+
+    /**
+     * @brief Get the highest linear speed the turn can be made at.
+     *
+     * @param max_centrifugal_acceleration Maximum centrifugal acceleration in m/s^2.
+     * @param max_angular_acceleration Maximum angular acceleration in rad/s^2.
+     * @return The maximum linear speed in m/s.
+     */
+    float get_max_speed(float max_centrifugal_acceleration, float max_angular_acceleration) const;
+
+    /**
+     * @brief Get the time taken to make the curve at a linear speed.
+     *
+     * @param linear_speed Linear speed in m/s.
+     * @return The duration of the curve in seconds.
+     */
+    float get_duration(float linear_speed) const;
+
+    /**
+     * @brief Get the absolute angle of the turn.
+     *
+     * @return The angle of the turn in radians.
+     */
+    float get_angle() const;
+
+    /**
+     * @brief Get the radius of the circular arc.
+     *
+     * @return The radius in meters.
+     */
+    float get_radius() const;
+
+    /**
+     * @brief Get the straight distance between the entry reference point and the start of the curve.
+     *
+     * @return The entry offset in meters.
+     */
+    float get_entry_offset() const;
+
+    /**
+     * @brief Get the straight distance between the end of the curve and the exit reference point.
+     *
+     * @return The exit offset in meters.
+     */
+    float get_exit_offset() const;
+
+    /**
+     * @brief Get the length of the curve.
+     *
+     * @return The length of the curve in meters.
+     */
+    float get_length() const;
+
+private:
+    /**
+     * @brief Calculate the distance travelled along a curve with unit radius until turning an angle.
+     *
+     * @param angle Absolute angle of the turn in radians.
+     * @param ramp_angle Angle turned in each clothoid in radians.
+     * @param orientation Absolute angle turned since the start of the curve in radians.
+     * @return The distance along the curve.
+     */
+    static float unit_curve_distance(float angle, float ramp_angle, float orientation);
+
+    /**
+     * @brief Calculate the displacement of a curve with unit radius.
+     *
+     * @param angle Absolute angle of the turn in radians.
+     * @param ramp_angle Angle turned in each clothoid in radians.
+     * @param end_distance Distance along the curve where the integration stops.
+     * @return The displacement from the start of the curve to the end distance.
+     */
+    static core::Vector unit_curve_displacement(float angle, float ramp_angle, float end_distance);
+
+    /**
+     * @brief Number of steps used to integrate the shape of the whole curve.
+     */
+    static constexpr uint16_t integration_steps{256};
+
+    /**
+     * @brief Number of samples of the position versus distance tables.
+     */
+    static constexpr uint16_t position_table_size{32};
+
+    /**
+     * @brief Absolute angle of the turn in radians.
+     */
+    float angle;
+
+    /**
+     * @brief Angle turned in each clothoid in radians.
+     */
+    float ramp_angle;
+
+    /**
+     * @brief Position on a curve with unit radius versus distance along it.
+     */
+    ///@{
+    core::TLookupTable<position_table_size> unit_position_x;
+    core::TLookupTable<position_table_size> unit_position_y;
+    ///@}
+
+    /**
+     * @brief Radius of the circular arc in meters.
+     */
+    float radius{};
+
+    /**
+     * @brief Straight distance before the curve in meters.
+     */
+    float entry_offset{};
+
+    /**
+     * @brief Straight distance after the curve in meters.
+     */
+    float exit_offset{};
+};
+}  // namespace micras::nav
+
+#endif  // MICRAS_NAV_TURN_PRIMITIVE_HPP
@@ -2,47 +2,70 @@
  * @file
  */
 
+#include <cmath>
 #include <numbers>
+#include <span>
+#include <vector>
 
 #include "micras/nav/action_queuer.hpp"
 
 namespace micras::nav {
 ActionQueuer::ActionQueuer(Config config) :
     cell_size{config.cell_size},
+    start_offset{config.start_offset},
     exploring_params{config.exploring},
-    // solving_params{config.solving},
-    stop{std::make_shared<MoveAction>(
-        ActionType::STOP, cell_size / 2.0F, exploring_params.max_linear_speed, 0.0F, exploring_params.max_linear_speed,
-        exploring_params.max_linear_acceleration, exploring_params.max_linear_deceleration, false
-    )},
-    start{std::make_shared<MoveAction>(
+    solving_params{config.solving},
+    search_90{config.turns.search_90},
+    large_90{config.turns.large_90},
+    u_turn_180{config.turns.u_turn_180},
+    in_45{config.turns.in_45},
+    out_45{config.turns.out_45},
+    in_135{config.turns.in_135},
+    out_135{config.turns.out_135},
+    v_90{config.turns.v_90},
+    start{std::make_shared<TabulatedMoveAction>(
         ActionType::START, cell_size - config.start_offset, 0.001F * exploring_params.max_linear_acceleration,
         exploring_params.max_linear_speed, exploring_params.max_linear_speed, exploring_params.max_linear_acceleration,
         exploring_params.max_linear_deceleration
     )},
-    move_forward{std::make_shared<MoveAction>(
+    move_forward{std::make_shared<TabulatedMoveAction>(
         ActionType::MOVE_FORWARD, cell_size, exploring_params.max_linear_speed, exploring_params.max_linear_speed,
         exploring_params.max_linear_speed, exploring_params.max_linear_acceleration,
         exploring_params.max_linear_deceleration
     )},
-    move_half{std::make_shared<MoveAction>(
-        ActionType::MOVE_HALF, cell_size / 2.0F, 0.001F * exploring_params.max_linear_acceleration,
-        exploring_params.max_linear_speed, exploring_params.max_linear_speed, exploring_params.max_linear_acceleration,
-        exploring_params.max_linear_deceleration, false
+    stop{std::make_shared<MoveAction>(
+        ActionType::STOP, cell_size / 2.0F, exploring_params.max_linear_speed, 0.0F, exploring_params.max_linear_speed,
+        exploring_params.max_linear_acceleration, exploring_params.max_linear_deceleration, false
     )},
-    turn_left{std::make_shared<TurnAction>(
+    turn_left{std::make_shared<TabulatedTurnAction>(
         ActionType::TURN_LEFT, std::numbers::pi_v<float> / 2.0F, cell_size / 2.0F, exploring_params.max_linear_speed,
         exploring_params.max_angular_acceleration
     )},
-    turn_right{std::make_shared<TurnAction>(
+    turn_right{std::make_shared<TabulatedTurnAction>(
         ActionType::TURN_RIGHT, -std::numbers::pi_v<float> / 2.0F, cell_size / 2.0F, exploring_params.max_linear_speed,
         exploring_params.max_angular_acceleration
     )},
-    turn_back{std::make_shared<TurnAction>(
-        ActionType::TURN_BACK, std::numbers::pi_v<float>, 0.0F, 0.0F, exploring_params.max_angular_acceleration
-    )} { }
+    turn_back{std::make_shared<TurnBackAction>(
+        ActionType::TURN_BACK, cell_size / 2.0F, cell_size / 2.0F, exploring_params.max_linear_speed,
+        exploring_params.max_linear_speed, exploring_params.max_linear_acceleration,
+        exploring_params.max_linear_deceleration, config.turn_back.max_angular_speed,
+        exploring_params.max_angular_acceleration, config.turn_back.overlap_speed, config.turn_back.launch_angle
+    )},
+    turn_back_from_rest{std::make_shared<TurnBackAction>(
+        ActionType::TURN_BACK, 0.0F, cell_size / 2.0F, 0.0F, exploring_params.max_linear_speed,
+        exploring_params.max_linear_acceleration, exploring_params.max_linear_deceleration,
+        config.turn_back.max_angular_speed, exploring_params.max_angular_acceleration, config.turn_back.overlap_speed,
+        config.turn_back.launch_angle
+    )} {
+    this->start->set_cell_edge(this->cell_size - this->start_offset);
+}
 
 void ActionQueuer::push(const GridPose& current_pose, const GridPoint& target_position) {
+    if (current_pose.position == target_position) {
+        this->action_queue.emplace(stop);
+        return;
+    }
+
     if (current_pose.front().position == target_position) {
         this->action_queue.emplace(move_forward);
         return;
@@ -59,15 +82,17 @@ void ActionQueuer::push(const GridPose& current_pose, const GridPoint& target_po
     }
 
     if (current_pose.turned_back().front().position == target_position) {
-        this->action_queue.emplace(stop);
         this->action_queue.emplace(turn_back);
-        this->action_queue.emplace(move_half);
         return;
     }
 }
 
 std::shared_ptr<Action> ActionQueuer::pop() {
-    const auto& action = this->action_queue.front();
+    if (this->action_queue.empty()) {
+        return nullptr;
+    }
+
+    auto action = this->action_queue.front();
     this->action_queue.pop();
     return action;
 }
@@ -78,14 +103,280 @@ bool ActionQueuer::empty() const {
 
 void ActionQueuer::recompute(const std::list<GridPose>& best_route) {
     this->action_queue = {};
-    this->action_queue.emplace(start);
 
-    if (best_route.empty()) {
+    if (best_route.size() < 2) {
+        this->action_queue.emplace(start);
         return;
     }
 
+    const std::vector<int8_t> moves = get_route_moves(best_route);
+
+    // Each sequence of turns starts with a turn right after the start or right after a forward movement
+    size_t num_of_turn_sequences = 0;
+
+    for (size_t i = 0; i < moves.size(); i++) {
+        if (moves[i] != 0 and (i == 0 or moves[i - 1] == 0)) {
+            num_of_turn_sequences++;
+        }
+    }
+
+    // The turn primitives are longer than the search turns, so they are only kept where they make the run faster
+    std::vector<bool> use_primitives(num_of_turn_sequences, true);
+    float             best_duration = this->estimate_duration(this->build_route_segments(moves, use_primitives));
+
+    for (size_t i = 0; i < num_of_turn_sequences; i++) {
+        use_primitives[i] = false;
+
+        const float duration = this->estimate_duration(this->build_route_segments(moves, use_primitives));
+
+        if (duration < best_duration) {
+            best_duration = duration;
+        } else {
+            use_primitives[i] = true;
+        }
+    }
+
+    const std::vector<RouteSegment> segments = this->build_route_segments(moves, use_primitives);
+    const std::vector<float>        speeds = this->plan_speeds(segments);
+
+    for (size_t i = 0; i < segments.size(); i++) {
+        const RouteSegment& segment = segments[i];
+
+        if (segment.primitive != nullptr) {
+            this->action_queue.emplace(
+                std::make_shared<CurveAction>(segment.action_id, *segment.primitive, segment.turning_left, speeds[i])
+            );
+            continue;
+        }
+
+        auto move = std::make_shared<TabulatedSCurveMoveAction>(
+            segment.action_id, segment.distance, speeds[i], speeds[i + 1], segment.max_speed,
+            this->solving_params.max_linear_acceleration, this->solving_params.max_linear_deceleration,
+            this->solving_params.max_linear_jerk, segment.follow_wall
+        );
+
+        move->set_cell_edge(segment.cell_edge);
+        this->action_queue.emplace(move);
+    }
+}
+
+void ActionQueuer::recompute_turn_back() {
+    this->action_queue = {};
+    this->action_queue.emplace(turn_back_from_rest);
+}
+
+std::vector<int8_t> ActionQueuer::get_route_moves(const std::list<GridPose>& best_route) {
+    std::vector<int8_t> moves;
+
     for (auto it = std::next(best_route.begin()); std::next(it) != best_route.end(); it++) {
-        this->push(*it, std::next(it)->position);
+        const GridPoint& next_position = std::next(it)->position;
+
+        if (it->front().position == next_position) {
+            moves.push_back(0);
+        } else if (it->turned_left().front().position == next_position) {
+            moves.push_back(1);
+        } else {
+            // The best route never turns back, so any other movement is a turn to the right
+            moves.push_back(-1);
+        }
+    }
+
+    return moves;
+}
+
+std::vector<ActionQueuer::RouteSegment> ActionQueuer::build_route_segments(
+    const std::vector<int8_t>& moves, const std::vector<bool>& use_primitives
+) const {
+    std::vector<RouteSegment> segments;
+
+    RouteSegment straight{
+        .action_id = ActionType::START,
+        .distance = this->cell_size - this->start_offset,
+        .primitive = nullptr,
+        .turning_left = false,
+        .max_speed = this->solving_params.max_linear_speed,
+        .follow_wall = true,
+        .cell_edge = this->cell_size - this->start_offset,
+    };
+
+    size_t turn_sequence = 0;
+
+    for (size_t i = 0; i < moves.size();) {
+        if (moves[i] == 0) {
+            straight.distance += this->cell_size;
+            i++;
+            continue;
+        }
+
+        size_t turns_end = i;
+
+        while (turns_end < moves.size() and moves[turns_end] != 0) {
+            turns_end++;
+        }
+
+        this->append_turns(
+            segments, straight, std::span{moves}.subspan(i, turns_end - i), use_primitives[turn_sequence]
+        );
+        turn_sequence++;
+        i = turns_end;
+    }
+
+    straight.action_id = ActionType::STOP;
+    straight.distance += this->cell_size / 2.0F;
+    segments.emplace_back(straight);
+
+    return segments;
+}
+
+void ActionQueuer::append_turns(
+    std::vector<RouteSegment>& segments, RouteSegment& straight, std::span<const int8_t> turns, bool use_primitives
+) const {
+    const float half_cell = this->cell_size / 2.0F;
+    const float diagonal_step = std::numbers::sqrt2_v<float> * half_cell;
+
+    bool fits_primitives = use_primitives and (straight.distance >= half_cell);
+
+    // Three turns to the same side would make the robot go around a post, which the primitives can not do
+    for (size_t i = 2; i < turns.size(); i++) {
+        if (turns[i] == turns[i - 1] and turns[i] == turns[i - 2]) {
+            fits_primitives = false;
+        }
+    }
+
+    if (not fits_primitives) {
+        for (const int8_t turn : turns) {
+            this->append_turn(segments, straight, this->search_90, turn > 0, 0.0F, 0.0F, false);
+        }
+
+        return;
+    }
+
+    if (turns.size() == 1) {
+        this->append_turn(segments, straight, this->large_90, turns.front() > 0, half_cell, half_cell, false);
+        return;
+    }
+
+    if (turns.size() == 2 and turns[0] == turns[1]) {
+        this->append_turn(segments, straight, this->u_turn_180, turns.front() > 0, half_cell, half_cell, false);
+        return;
+    }
+
+    const bool   entry_135 = (turns[0] == turns[1]);
+    const bool   exit_135 = (turns[turns.size() - 1] == turns[turns.size() - 2]);
+    const size_t diagonal_start = entry_135 ? 2 : 1;
+    const size_t diagonal_end = turns.size() - (exit_135 ? 2 : 1);
+
+    this->append_turn(
+        segments, straight, entry_135 ? this->in_135 : this->in_45, turns.front() > 0, half_cell, 0.0F, true
+    );
+
+    for (size_t i = diagonal_start; i < diagonal_end;) {
+        if (i + 1 < diagonal_end and turns[i] == turns[i + 1]) {
+            this->append_turn(segments, straight, this->v_90, turns[i] > 0, 0.0F, 0.0F, true);
+            i += 2;
+            continue;
+        }
+
+        straight.distance += diagonal_step;
+        i++;
+    }
+
+    this->append_turn(
+        segments, straight, exit_135 ? this->out_135 : this->out_45, turns.back() > 0, 0.0F, half_cell, false
+    );
+}
+
+void ActionQueuer::append_turn(
+    std::vector<RouteSegment>& segments, RouteSegment& straight, const TurnPrimitive& primitive, bool turning_left,
+    float entry_leg, float exit_leg, bool diagonal_exit
+) const {
+    straight.distance += primitive.get_entry_offset() - entry_leg;
+
+    if (straight.distance > 0.0F) {
+        segments.emplace_back(straight);
+    }
+
+    segments.push_back({
+        .action_id = turning_left ? ActionType::TURN_LEFT : ActionType::TURN_RIGHT,
+        .distance = 0.0F,
+        .primitive = &primitive,
+        .turning_left = turning_left,
+        .max_speed = primitive.get_max_speed(
+            this->solving_params.max_centrifugal_acceleration, this->solving_params.max_angular_acceleration
+        ),
+        .follow_wall = false,
+        .cell_edge = 0.0F,
+    });
+
+    straight = {
+        .action_id = diagonal_exit ? ActionType::MOVE_DIAGONAL : ActionType::MOVE_FORWARD,
+        .distance = primitive.get_exit_offset() - exit_leg,
+        .primitive = nullptr,
+        .turning_left = false,
+        .max_speed = this->solving_params.max_linear_speed,
+        .follow_wall = not diagonal_exit,
+        .cell_edge = primitive.get_exit_offset() - exit_leg,
+    };
+}
+
+std::vector<float> ActionQueuer::plan_speeds(const std::vector<RouteSegment>& segments) const {
+    std::vector<float> speeds(segments.size() + 1, this->solving_params.max_linear_speed);
+
+    for (size_t i = 0; i < segments.size(); i++) {
+        speeds[i] = std::fminf(speeds[i], segments[i].max_speed);
+        speeds[i + 1] = std::fminf(speeds[i + 1], segments[i].max_speed);
+    }
+
+    speeds.front() = std::fminf(speeds.front(), 0.001F * this->solving_params.max_linear_acceleration);
+    speeds.back() = 0.0F;
+
+    for (size_t i = 0; i < segments.size(); i++) {
+        speeds[i + 1] = std::fminf(
+            speeds[i + 1], SCurveMoveAction::max_reachable_speed(
+                               speeds[i], segments[i].distance, segments[i].max_speed,
+                               this->solving_params.max_linear_acceleration, this->solving_params.max_linear_jerk
+                           )
+        );
+    }
+
+    for (size_t i = segments.size(); i > 0; i--) {
+        speeds[i - 1] = std::fminf(
+            speeds[i - 1], SCurveMoveAction::max_reachable_speed(
+                               speeds[i], segments[i - 1].distance, segments[i - 1].max_speed,
+                               this->solving_params.max_linear_deceleration, this->solving_params.max_linear_jerk
+                           )
+        );
+    }
+
+    return speeds;
+}
+
+float ActionQueuer::estimate_duration(const std::vector<RouteSegment>& segments) const {
+    const std::vector<float> speeds = this->plan_speeds(segments);
+    float                    duration = 0.0F;
+
+    for (size_t i = 0; i < segments.size(); i++) {
+        const RouteSegment& segment = segments[i];
+
+        if (segment.primitive != nullptr) {
+            duration += segment.primitive->get_duration(speeds[i]);
+            continue;
+        }
+
+        const SCurveMoveAction straight{
+            segment.action_id,
+            segment.distance,
+            speeds[i],
+            speeds[i + 1],
+            segment.max_speed,
+            this->solving_params.max_linear_acceleration,
+            this->solving_params.max_linear_deceleration,
+            this->solving_params.max_linear_jerk,
+        };
+
+        duration += straight.get_duration();
     }
+
+    return duration;
 }
 }  // namespace micras::nav
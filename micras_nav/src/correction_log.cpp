@@ -0,0 +1,55 @@
+/**
+ * @file
+ */
+
+#ifndef MICRAS_NAV_CORRECTION_LOG_CPP
+#define MICRAS_NAV_CORRECTION_LOG_CPP
+
+#include <cmath>
+
+#include "micras/nav/correction_log.hpp"
+
+namespace micras::nav {
+template <uint16_t max_size>
+void TCorrectionLog<max_size>::record(const Entry& entry) {
+    this->entries.at(this->num_of_entries % max_size) = entry;
+    this->num_of_entries++;
+    this->counts.at(entry.source)++;
+    this->squared_error_sums.at(entry.source) += entry.error * entry.error;
+}
+
+template <uint16_t max_size>
+const typename TCorrectionLog<max_size>::Entry& TCorrectionLog<max_size>::get(uint16_t index) const {
+    const uint32_t oldest = this->num_of_entries < max_size ? 0 : this->num_of_entries % max_size;
+
+    return this->entries.at((oldest + index) % max_size);
+}
+
+template <uint16_t max_size>
+uint16_t TCorrectionLog<max_size>::size() const {
+    return this->num_of_entries < max_size ? this->num_of_entries : max_size;
+}
+
+template <uint16_t max_size>
+uint32_t TCorrectionLog<max_size>::get_count(Source source) const {
+    return this->counts.at(source);
+}
+
+template <uint16_t max_size>
+float TCorrectionLog<max_size>::get_rms_error(Source source) const {
+    if (this->counts.at(source) == 0) {
+        return 0.0F;
+    }
+
+    return std::sqrt(this->squared_error_sums.at(source) / this->counts.at(source));
+}
+
+template <uint16_t max_size>
+void TCorrectionLog<max_size>::clear() {
+    this->num_of_entries = 0;
+    this->counts = {};
+    this->squared_error_sums = {};
+}
+}  // namespace micras::nav
+
+#endif  // MICRAS_NAV_CORRECTION_LOG_CPP
@@ -0,0 +1,151 @@
+/**
+ * @file
+ */
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <span>
+
+#include "micras/nav/feed_forward_estimator.hpp"
+
+namespace micras::nav {
+FeedForwardEstimator::FeedForwardEstimator(
+    const Config& config, const FeedForward& left_feed_forward, const FeedForward& right_feed_forward
+) :
+    estimator{config.estimator, {to_parameters(left_feed_forward), to_parameters(right_feed_forward)}},
+    filter{config.filter},
+    min_linear_speed{config.min_linear_speed},
+    min_angular_speed{config.min_angular_speed},
+    max_command{config.max_command},
+    min_num_of_samples{config.min_num_of_samples},
+    min_gains{config.min_gains},
+    max_gains{config.max_gains},
+    left_feed_forward{left_feed_forward},
+    right_feed_forward{right_feed_forward} { }
+
+void FeedForwardEstimator::update(const Twist& velocity, float left_command, float right_command, float elapsed_time) {
+    const auto& filtered = this->filter.update({left_command, right_command, velocity.linear, velocity.angular});
+    const Twist filtered_velocity{filtered[Signal::LINEAR_SPEED], filtered[Signal::ANGULAR_SPEED]};
+    const Twist last_velocity = this->last_velocity;
+    const bool  has_last_velocity = this->has_last_velocity;
+
+    this->last_velocity = filtered_velocity;
+    this->has_last_velocity = true;
+
+    if (not has_last_velocity or std::max(std::abs(left_command), std::abs(right_command)) >= this->max_command or
+        (std::abs(filtered_velocity.linear) < this->min_linear_speed and
+         std::abs(filtered_velocity.angular) < this->min_angular_speed)) {
+        return;
+    }
+
+    this->estimator.update(
+        {filtered_velocity.linear, (filtered_velocity.linear - last_velocity.linear) / elapsed_time,
+         filtered_velocity.angular, (filtered_velocity.angular - last_velocity.angular) / elapsed_time},
+        {filtered[Signal::LEFT_COMMAND], filtered[Signal::RIGHT_COMMAND]}
+    );
+
+    if (this->estimator.get_num_of_samples() < this->min_num_of_samples) {
+        return;
+    }
+
+    const FeedForward left_estimate = to_feed_forward(this->estimator.get_parameters(0));
+    const FeedForward right_estimate = to_feed_forward(this->estimator.get_parameters(1));
+
+    // The wheels are accepted together, so the robot is never driven by gains from different estimates
+    if (this->is_within_bounds(left_estimate) and this->is_within_bounds(right_estimate)) {
+        this->left_feed_forward = left_estimate;
+        this->right_feed_forward = right_estimate;
+    }
+}
+
+const FeedForwardEstimator::FeedForward& FeedForwardEstimator::get_left_feed_forward() const {
+    return this->left_feed_forward;
+}
+
+const FeedForwardEstimator::FeedForward& FeedForwardEstimator::get_right_feed_forward() const {
+    return this->right_feed_forward;
+}
+
+void FeedForwardEstimator::reset() {
+    this->filter.reset();
+    this->has_last_velocity = false;
+}
+
+std::vector<uint8_t> FeedForwardEstimator::serialize() const {
+    std::vector<uint8_t> buffer;
+    buffer.reserve(2 * sizeof(FeedForward));
+
+    for (const auto& feed_forward : {this->left_feed_forward, this->right_feed_forward}) {
+        for (const float value : to_parameters(feed_forward)) {
+            const auto bytes = std::bit_cast<std::array<uint8_t, sizeof(float)>>(value);
+            buffer.insert(buffer.end(), bytes.begin(), bytes.end());
+        }
+    }
+
+    return buffer;
+}
+
+void FeedForwardEstimator::deserialize(const uint8_t* buffer, uint16_t size) {
+    // Gains saved with another layout are discarded, keeping the configured ones
+    if (size != 2 * sizeof(FeedForward)) {
+        return;
+    }
+
+    const std::span<const uint8_t>      data{buffer, size};
+    std::array<std::array<float, 4>, 2> parameters{};
+
+    for (uint8_t i = 0; i < parameters.size(); i++) {
+        for (uint8_t j = 0; j < parameters.at(i).size(); j++) {
+            std::array<uint8_t, sizeof(float)> bytes{};
+            const auto value_data = data.subspan((i * parameters.at(i).size() + j) * sizeof(float), sizeof(float));
+
+            std::copy(value_data.begin(), value_data.end(), bytes.begin());
+            parameters.at(i).at(j) = std::bit_cast<float>(bytes);
+        }
+    }
+
+    const FeedForward left_feed_forward = to_feed_forward(parameters[0]);
+    const FeedForward right_feed_forward = to_feed_forward(parameters[1]);
+
+    // Corrupted or outdated gains would drive the robot blindly, so they are discarded too
+    if (not this->is_within_bounds(left_feed_forward) or not this->is_within_bounds(right_feed_forward)) {
+        return;
+    }
+
+    this->left_feed_forward = left_feed_forward;
+    this->right_feed_forward = right_feed_forward;
+    this->estimator.reset(parameters);
+}
+
+std::array<float, 4> FeedForwardEstimator::to_parameters(const FeedForward& feed_forward) {
+    return {
+        feed_forward.linear_speed, feed_forward.linear_acceleration, feed_forward.angular_speed,
+        feed_forward.angular_acceleration
+    };
+}
+
+FeedForwardEstimator::FeedForward FeedForwardEstimator::to_feed_forward(const std::array<float, 4>& parameters) {
+    return {
+        .linear_speed = parameters[0],
+        .linear_acceleration = parameters[1],
+        .angular_speed = parameters[2],
+        .angular_acceleration = parameters[3],
+    };
+}
+
+bool FeedForwardEstimator::is_within_bounds(const FeedForward& feed_forward) const {
+    const auto gains = to_parameters(feed_forward);
+    const auto min_gains = to_parameters(this->min_gains);
+    const auto max_gains = to_parameters(this->max_gains);
+
+    for (uint8_t i = 0; i < gains.size(); i++) {
+        // NaN fails both comparisons, so it is out of bounds as well
+        if (not(gains[i] >= min_gains[i] and gains[i] <= max_gains[i])) {
+            return false;
+        }
+    }
+
+    return true;
+}
+}  // namespace micras::nav
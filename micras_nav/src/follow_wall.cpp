@@ -2,6 +2,9 @@
  * @file
  */
 
+#include <algorithm>
+#include <cmath>
+
 #include "micras/nav/follow_wall.hpp"
 
 namespace micras::nav {
@@ -15,14 +18,21 @@ FollowWall::FollowWall(
     post_threshold{config.post_threshold},
     blind_pose{absolute_pose},
     cell_size{config.cell_size},
-    post_clearance{config.post_clearance} { }
+    post_clearance{config.post_clearance},
+    heading_window{config.heading_window},
+    heading_lookahead{config.heading_lookahead},
+    window_pose{absolute_pose} { }
 
 float FollowWall::compute_angular_correction(float elapsed_time, float linear_speed) {
     if (this->wall_sensors.use_count() == 1) {
-        this->wall_sensors->update();
+        this->wall_sensors->update(linear_speed);
     }
 
-    if (this->check_posts()) {
+    this->post_seen = this->check_posts();
+    this->new_estimate = false;
+
+    if (this->post_seen) {
+        this->restart_estimate();
         return 0.0F;
     }
 
@@ -31,20 +41,15 @@ float FollowWall::compute_angular_correction(float elapsed_time, float linear_sp
         this->reset();
     }
 
-    float error{};
-
-    if (this->following_left and this->following_right) {
-        error = this->wall_sensors->get_sensor_error(this->sensor_index.left) -
-                this->wall_sensors->get_sensor_error(this->sensor_index.right);
-    } else if (this->following_left) {
-        error = 2.0F * this->wall_sensors->get_sensor_error(this->sensor_index.left);
-    } else if (this->following_right) {
-        error = -2.0F * this->wall_sensors->get_sensor_error(this->sensor_index.right);
-    } else {
+    if (not this->is_following_walls()) {
+        this->heading_estimated = false;
         return 0.0F;
     }
 
-    const float response = this->pid.compute_response(error, elapsed_time);
+    this->update_estimate();
+
+    const float heading_term = this->heading_estimated ? this->heading_lookahead * std::sin(this->get_heading()) : 0.0F;
+    const float response = this->pid.compute_response(this->lateral_offset + heading_term, elapsed_time);
 
     return response * linear_speed / this->max_linear_speed;
 }
@@ -87,26 +92,118 @@ bool FollowWall::check_posts() {
     this->last_left_error = this->wall_sensors->get_sensor_error(this->sensor_index.left);
     this->last_right_error = this->wall_sensors->get_sensor_error(this->sensor_index.right);
 
+    if (found_posts) {
+        this->post_lag = this->wall_sensors->get_lag();
+    }
+
     return found_posts;
 }
 
 core::Observation FollowWall::get_observation() const {
     const bool front_wall = this->wall_sensors->get_wall(this->sensor_index.left_front) and
                             this->wall_sensors->get_wall(this->sensor_index.right_front);
-    const bool disturbed = front_wall;
 
     return {
-        .left = this->wall_sensors->get_wall(this->sensor_index.left, disturbed),
+        .left = this->wall_sensors->get_wall(this->sensor_index.left),
         .front = front_wall,
-        .right = this->wall_sensors->get_wall(this->sensor_index.right, disturbed),
+        .right = this->wall_sensors->get_wall(this->sensor_index.right),
     };
 }
 
+bool FollowWall::reached_front_wall() const {
+    return this->wall_sensors->get_wall(this->sensor_index.left_front) and
+           this->wall_sensors->get_wall(this->sensor_index.right_front) and
+           this->wall_sensors->get_sensor_error(this->sensor_index.left_front) +
+                   this->wall_sensors->get_sensor_error(this->sensor_index.right_front) >=
+               0.0F;
+}
+
+bool FollowWall::is_following_walls() const {
+    return this->following_left or this->following_right;
+}
+
+bool FollowWall::saw_post() const {
+    return this->post_seen;
+}
+
+float FollowWall::get_post_lag() const {
+    return this->post_lag;
+}
+
+float FollowWall::get_lateral_offset() const {
+    return this->lateral_offset;
+}
+
+float FollowWall::get_heading() const {
+    return this->window_heading + this->window_pose.get().orientation;
+}
+
+bool FollowWall::has_new_estimate() const {
+    return this->new_estimate;
+}
+
+Pose FollowWall::get_window_pose() const {
+    return this->window_pose.get();
+}
+
+void FollowWall::continue_window(const Pose& window_pose) {
+    this->window_pose.continue_reference(window_pose);
+}
+
+void FollowWall::update_estimate() {
+    this->lateral_offset = this->compute_lateral_offset();
+
+    const Pose window = this->window_pose.get();
+
+    if (window.position.x < this->heading_window) {
+        return;
+    }
+
+    // The lateral offset changes with the mean heading over the window, which is half of the rotation behind the end
+    const float mean_heading =
+        std::asin(std::clamp((this->lateral_offset - this->window_lateral_offset) / window.position.x, -1.0F, 1.0F));
+
+    this->window_heading = mean_heading + window.orientation / 2.0F;
+    this->window_pose.reset_reference();
+    this->window_lateral_offset = this->lateral_offset;
+    this->heading_estimated = true;
+    this->new_estimate = true;
+}
+
+void FollowWall::restart_estimate() {
+    this->window_pose.reset_reference();
+    this->window_lateral_offset = this->compute_lateral_offset();
+    this->lateral_offset = this->window_lateral_offset;
+    this->window_heading = 0.0F;
+    this->heading_estimated = false;
+    this->new_estimate = false;
+}
+
+float FollowWall::compute_lateral_offset() const {
+    if (this->following_left and this->following_right) {
+        return (this->wall_sensors->get_distance_error(this->sensor_index.right) -
+                this->wall_sensors->get_distance_error(this->sensor_index.left)) /
+               2.0F;
+    }
+
+    if (this->following_left) {
+        return -this->wall_sensors->get_distance_error(this->sensor_index.left);
+    }
+
+    if (this->following_right) {
+        return this->wall_sensors->get_distance_error(this->sensor_index.right);
+    }
+
+    return 0.0F;
+}
+
 void FollowWall::reset() {
     this->pid.reset();
+    this->post_seen = false;
     this->reset_displacement();
     this->following_left = this->wall_sensors->get_wall(this->sensor_index.left);
     this->following_right = this->wall_sensors->get_wall(this->sensor_index.right);
+    this->restart_estimate();
 }
 
 void FollowWall::reset_displacement(bool reset_by_post) {
@@ -4,6 +4,8 @@
 
 #include <cmath>
 
+#include "micras/core/fastmath.hpp"
+#include "micras/core/utils.hpp"
 #include "micras/nav/odometry.hpp"
 
 namespace micras::nav {
@@ -18,10 +20,19 @@ Odometry::Odometry(
     wheel_radius{config.wheel_radius},
     left_last_position{left_rotary_sensor->get_position()},
     right_last_position{right_rotary_sensor->get_position()},
+    pose_estimator{config.pose_estimator},
+    linear_estimator{config.linear_estimator},
     linear_filter{config.linear_cutoff_frequency},
+    linear_observer{config.linear_observer},
+    left_velocity_estimator{config.wheel_velocity, left_rotary_sensor->get_position_step()},
+    right_velocity_estimator{config.wheel_velocity, right_rotary_sensor->get_position_step()},
+    position_variance{config.position_deviation * config.position_deviation},
+    orientation_variance{config.orientation_deviation * config.orientation_deviation},
+    kalman_filter{config.kalman_filter, config.initial_pose},
+    gyro_bias_estimator{config.gyro_bias},
     state{config.initial_pose, {0.0F, 0.0F}} { }
 
-void Odometry::update(float elapsed_time) {
+void Odometry::update(float elapsed_time, float linear_acceleration) {
     if (this->imu.use_count() == 1) {
         this->imu->update();
     }
@@ -29,6 +40,13 @@ void Odometry::update(float elapsed_time) {
     const float left_position = this->left_rotary_sensor->get_position();
     const float right_position = this->right_rotary_sensor->get_position();
 
+    const float left_velocity = this->left_velocity_estimator.update(
+        left_position - this->left_last_position, this->left_rotary_sensor->get_edge_age(), elapsed_time
+    );
+    const float right_velocity = this->right_velocity_estimator.update(
+        right_position - this->right_last_position, this->right_rotary_sensor->get_edge_age(), elapsed_time
+    );
+
     const float left_distance = this->wheel_radius * (left_position - this->left_last_position);
     const float right_distance = this->wheel_radius * (right_position - this->right_last_position);
 
@@ -36,18 +54,36 @@ void Odometry::update(float elapsed_time) {
     this->right_last_position = right_position;
 
     const float linear_distance = (left_distance + right_distance) / 2;
+    const float linear_speed = this->wheel_radius * (left_velocity + right_velocity) / 2;
+
+    if (this->pose_estimator == PoseEstimator::KALMAN_FILTER) {
+        this->kalman_filter.predict(this->imu->get_linear_acceleration(proxy::Imu::Axis::X), elapsed_time);
+        this->kalman_filter.update_linear_speed(linear_speed);
+        this->kalman_filter.update_angular_speed(this->imu->get_angular_velocity(proxy::Imu::Axis::Z));
+        this->state = this->kalman_filter.get_state();
+        return;
+    }
+
+    if (this->linear_estimator == LinearEstimator::OBSERVER) {
+        this->state.velocity.linear = this->linear_observer.update(linear_distance, linear_acceleration, elapsed_time);
+    } else if (this->linear_estimator == LinearEstimator::EDGE_PERIOD) {
+        this->state.velocity.linear = linear_speed;
+    } else {
+        this->state.velocity.linear = this->linear_filter.update(linear_distance / elapsed_time);
+    }
 
-    this->state.velocity.linear = this->linear_filter.update(linear_distance / elapsed_time);
     this->state.velocity.angular = this->imu->get_angular_velocity(proxy::Imu::Axis::Z);
 
-    const float angular_distance = this->state.velocity.angular * elapsed_time;
+    const float angular_distance = this->imu->get_angular_displacement(elapsed_time);
 
     const float half_angle = angular_distance / 2;
     const float linear_diagonal =
         angular_distance < 0.05F ? linear_distance : std::abs(std::sin(half_angle) * linear_distance / half_angle);
 
-    this->state.pose.position.x += linear_diagonal * std::cos(this->state.pose.orientation + half_angle);
-    this->state.pose.position.y += linear_diagonal * std::sin(this->state.pose.orientation + half_angle);
+    const auto [sin, cos] = core::math::sincos(this->state.pose.orientation + half_angle);
+
+    this->state.pose.position.x += linear_diagonal * cos;
+    this->state.pose.position.y += linear_diagonal * sin;
 
     this->state.pose.orientation += angular_distance;
 }
@@ -56,6 +92,60 @@ void Odometry::reset() {
     this->left_last_position = this->left_rotary_sensor->get_position();
     this->right_last_position = this->right_rotary_sensor->get_position();
     this->state = {{{0.0F, 0.0F}, 0.0F}, {0.0F, 0.0F}};
+    this->linear_observer.reset();
+    this->left_velocity_estimator.reset();
+    this->right_velocity_estimator.reset();
+    this->kalman_filter.reset(this->state.pose);
+}
+
+void Odometry::update_gyro_bias(float elapsed_time) {
+    this->gyro_bias_estimator.update(
+        {
+            .angular_velocity = this->imu->get_angular_velocity(proxy::Imu::Axis::Z) + this->imu->get_gyro_bias(),
+            .linear_acceleration_x = this->imu->get_linear_acceleration(proxy::Imu::Axis::X),
+            .linear_acceleration_y = this->imu->get_linear_acceleration(proxy::Imu::Axis::Y),
+            .temperature = this->imu->get_temperature(),
+            .left_wheel_position = this->left_rotary_sensor->get_position(),
+            .right_wheel_position = this->right_rotary_sensor->get_position(),
+        },
+        elapsed_time
+    );
+
+    if (this->gyro_bias_estimator.has_estimate()) {
+        const float gyro_bias = this->gyro_bias_estimator.get_bias(this->imu->get_temperature());
+
+        // The filter estimates the bias left after the correction of the IMU, which moves against the correction
+        this->kalman_filter.shift_gyro_bias(this->imu->get_gyro_bias() - gyro_bias);
+        this->imu->set_gyro_bias(gyro_bias);
+    }
+}
+
+void Odometry::correct_position(const core::Vector& direction, float position, float deviation) {
+    if (this->pose_estimator == PoseEstimator::KALMAN_FILTER) {
+        this->kalman_filter.correct_position(direction, position, deviation);
+        this->state = this->kalman_filter.get_state();
+        return;
+    }
+
+    const float error =
+        position - (direction.x * this->state.pose.position.x + direction.y * this->state.pose.position.y);
+    const float gain = this->position_variance / (this->position_variance + deviation * deviation);
+
+    this->state.pose.position.x += gain * error * direction.x;
+    this->state.pose.position.y += gain * error * direction.y;
+}
+
+void Odometry::correct_orientation(float orientation, float deviation) {
+    if (this->pose_estimator == PoseEstimator::KALMAN_FILTER) {
+        this->kalman_filter.correct_orientation(orientation, deviation);
+        this->state = this->kalman_filter.get_state();
+        return;
+    }
+
+    const float error = core::assert_angle(orientation - this->state.pose.orientation);
+    const float gain = this->orientation_variance / (this->orientation_variance + deviation * deviation);
+
+    this->state.pose.orientation += gain * error;
 }
 
 const nav::State& Odometry::get_state() const {
@@ -64,5 +154,6 @@ const nav::State& Odometry::get_state() const {
 
 void Odometry::set_state(const nav::State& new_state) {
     this->state = new_state;
+    this->kalman_filter.reset(new_state.pose);
 }
 }  // namespace micras::nav
@@ -0,0 +1,152 @@
+/**
+ * @file
+ */
+
+#include "micras/core/fastmath.hpp"
+#include "micras/nav/pose_kalman_filter.hpp"
+
+namespace micras::nav {
+PoseKalmanFilter::PoseKalmanFilter(const Config& config, const Pose& initial_pose) :
+    linear_acceleration_variance{config.linear_acceleration_noise * config.linear_acceleration_noise},
+    angular_acceleration_variance{config.angular_acceleration_noise * config.angular_acceleration_noise},
+    gyro_bias_drift_variance{config.gyro_bias_drift * config.gyro_bias_drift},
+    encoder_variance{config.encoder_noise * config.encoder_noise},
+    gyro_variance{config.gyro_noise * config.gyro_noise} {
+    this->covariance[GYRO_BIAS][GYRO_BIAS] = config.initial_gyro_bias_deviation * config.initial_gyro_bias_deviation;
+    this->reset(initial_pose);
+}
+
+void PoseKalmanFilter::predict(float linear_acceleration, float elapsed_time) {
+    const float linear_distance = this->state[LINEAR_SPEED] * elapsed_time;
+    const float half_angle = this->state[ANGULAR_SPEED] * elapsed_time / 2.0F;
+    const auto [sin_orientation, cos_orientation] = core::math::sincos(this->state[ORIENTATION] + half_angle);
+
+    this->state[POSITION_X] += linear_distance * cos_orientation;
+    this->state[POSITION_Y] += linear_distance * sin_orientation;
+    this->state[ORIENTATION] += 2.0F * half_angle;
+    this->state[LINEAR_SPEED] += linear_acceleration * elapsed_time;
+
+    Matrix jacobian{};
+
+    for (uint8_t i = 0; i < size; i++) {
+        jacobian[i][i] = 1.0F;
+    }
+
+    jacobian[POSITION_X][ORIENTATION] = -linear_distance * sin_orientation;
+    jacobian[POSITION_X][LINEAR_SPEED] = elapsed_time * cos_orientation;
+    jacobian[POSITION_X][ANGULAR_SPEED] = -linear_distance * sin_orientation * elapsed_time / 2.0F;
+    jacobian[POSITION_Y][ORIENTATION] = linear_distance * cos_orientation;
+    jacobian[POSITION_Y][LINEAR_SPEED] = elapsed_time * sin_orientation;
+    jacobian[POSITION_Y][ANGULAR_SPEED] = linear_distance * cos_orientation * elapsed_time / 2.0F;
+    jacobian[ORIENTATION][ANGULAR_SPEED] = elapsed_time;
+
+    Matrix propagated{};
+
+    for (uint8_t i = 0; i < size; i++) {
+        for (uint8_t j = 0; j < size; j++) {
+            for (uint8_t k = 0; k < size; k++) {
+                propagated[i][j] += jacobian[i][k] * this->covariance[k][j];
+            }
+        }
+    }
+
+    for (uint8_t i = 0; i < size; i++) {
+        for (uint8_t j = 0; j < size; j++) {
+            this->covariance[i][j] = 0.0F;
+
+            for (uint8_t k = 0; k < size; k++) {
+                this->covariance[i][j] += propagated[i][k] * jacobian[j][k];
+            }
+        }
+    }
+
+    this->covariance[LINEAR_SPEED][LINEAR_SPEED] += this->linear_acceleration_variance * elapsed_time * elapsed_time;
+    this->covariance[ANGULAR_SPEED][ANGULAR_SPEED] += this->angular_acceleration_variance * elapsed_time * elapsed_time;
+    this->covariance[GYRO_BIAS][GYRO_BIAS] += this->gyro_bias_drift_variance * elapsed_time;
+}
+
+void PoseKalmanFilter::update_linear_speed(float linear_speed) {
+    Vector observation{};
+    observation[LINEAR_SPEED] = 1.0F;
+
+    this->correct(observation, linear_speed - this->state[LINEAR_SPEED], this->encoder_variance);
+}
+
+void PoseKalmanFilter::update_angular_speed(float angular_speed) {
+    Vector observation{};
+    observation[ANGULAR_SPEED] = 1.0F;
+    observation[GYRO_BIAS] = 1.0F;
+
+    this->correct(
+        observation, angular_speed - this->state[ANGULAR_SPEED] - this->state[GYRO_BIAS], this->gyro_variance
+    );
+}
+
+void PoseKalmanFilter::correct_position(const core::Vector& direction, float position, float deviation) {
+    Vector observation{};
+    observation[POSITION_X] = direction.x;
+    observation[POSITION_Y] = direction.y;
+
+    const float predicted = direction.x * this->state[POSITION_X] + direction.y * this->state[POSITION_Y];
+
+    this->correct(observation, position - predicted, deviation * deviation);
+}
+
+void PoseKalmanFilter::correct_orientation(float orientation, float deviation) {
+    Vector observation{};
+    observation[ORIENTATION] = 1.0F;
+
+    this->correct(observation, orientation - this->state[ORIENTATION], deviation * deviation);
+}
+
+void PoseKalmanFilter::reset(const Pose& pose) {
+    const float gyro_bias = this->state[GYRO_BIAS];
+    const float gyro_bias_variance = this->covariance[GYRO_BIAS][GYRO_BIAS];
+
+    this->state = {pose.position.x, pose.position.y, pose.orientation, 0.0F, 0.0F, gyro_bias};
+    this->covariance = {};
+    this->covariance[GYRO_BIAS][GYRO_BIAS] = gyro_bias_variance;
+}
+
+State PoseKalmanFilter::get_state() const {
+    return {
+        {{this->state[POSITION_X], this->state[POSITION_Y]}, this->state[ORIENTATION]},
+        {this->state[LINEAR_SPEED], this->state[ANGULAR_SPEED]},
+    };
+}
+
+float PoseKalmanFilter::get_gyro_bias() const {
+    return this->state[GYRO_BIAS];
+}
+
+void PoseKalmanFilter::shift_gyro_bias(float offset) {
+    this->state[GYRO_BIAS] += offset;
+}
+
+void PoseKalmanFilter::correct(const Vector& observation, float residual, float variance) {
+    Vector covariance_observation{};
+    float  innovation_variance = variance;
+
+    for (uint8_t i = 0; i < size; i++) {
+        for (uint8_t j = 0; j < size; j++) {
+            covariance_observation[i] += this->covariance[i][j] * observation[j];
+        }
+
+        innovation_variance += observation[i] * covariance_observation[i];
+    }
+
+    if (innovation_variance <= 0.0F) {
+        return;
+    }
+
+    for (uint8_t i = 0; i < size; i++) {
+        const float gain = covariance_observation[i] / innovation_variance;
+
+        this->state[i] += gain * residual;
+
+        for (uint8_t j = 0; j < size; j++) {
+            this->covariance[i][j] -= gain * covariance_observation[j];
+        }
+    }
+}
+}  // namespace micras::nav
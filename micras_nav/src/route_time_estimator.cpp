@@ -0,0 +1,22 @@
+/**
+ * @file
+ */
+
+#include "micras/nav/route_time_estimator.hpp"
+
+namespace micras::nav {
+RouteTimeEstimator::RouteTimeEstimator(const ActionQueuer::Config& action_queuer_config, Config config) :
+    action_queuer{action_queuer_config}, sample_time{config.sample_time} { }
+
+float RouteTimeEstimator::estimate(const std::list<GridPose>& route) {
+    float time = 0.0F;
+
+    this->action_queuer.recompute(route);
+
+    while (not this->action_queuer.empty()) {
+        time += this->action_queuer.pop()->preview(this->sample_time).duration;
+    }
+
+    return time;
+}
+}  // namespace micras::nav
@@ -11,19 +11,18 @@ namespace micras::nav {
 SpeedController::SpeedController(const Config& config) :
     max_linear_acceleration{config.max_linear_acceleration},
     max_angular_acceleration{config.max_angular_acceleration},
-    linear_pid(config.linear_pid),
-    angular_pid(config.angular_pid),
+    pid_bank{{config.linear_pid, config.angular_pid}},
     left_feed_forward{config.left_feed_forward},
     right_feed_forward{config.right_feed_forward} { }
 
 std::pair<float, float> SpeedController::compute_control_commands(
     const Twist& current_twist, const Twist& desired_twist, float elapsed_time
 ) {
-    this->linear_pid.set_setpoint(desired_twist.linear);
-    this->angular_pid.set_setpoint(desired_twist.angular);
+    this->pid_bank.set_setpoints({desired_twist.linear, desired_twist.angular});
 
-    const float linear_command = this->linear_pid.compute_response(current_twist.linear, elapsed_time);
-    const float angular_command = this->angular_pid.compute_response(current_twist.angular, elapsed_time);
+    const auto& commands = this->pid_bank.update({current_twist.linear, current_twist.angular}, elapsed_time);
+    const float linear_command = commands[Pid::LINEAR];
+    const float angular_command = commands[Pid::ANGULAR];
 
     return {linear_command - angular_command, linear_command + angular_command};
 }
@@ -38,6 +37,7 @@ std::pair<float, float> SpeedController::compute_feed_forward_commands(const Twi
 
     this->last_linear_speed = desired_twist.linear;
     this->last_angular_speed = desired_twist.angular;
+    this->last_acceleration = acceleration_twist;
 
     const float left_feed_forward = feed_forward(desired_twist, acceleration_twist, this->left_feed_forward);
     const float right_feed_forward = feed_forward(desired_twist, acceleration_twist, this->right_feed_forward);
@@ -50,8 +50,27 @@ float SpeedController::feed_forward(const Twist& speed, const Twist& acceleratio
            config.angular_speed * speed.angular + config.angular_acceleration * acceleration.angular;
 }
 
+const Twist& SpeedController::get_last_acceleration() const {
+    return this->last_acceleration;
+}
+
+void SpeedController::set_feed_forward(
+    const Config::FeedForward& left_feed_forward, const Config::FeedForward& right_feed_forward
+) {
+    this->left_feed_forward = left_feed_forward;
+    this->right_feed_forward = right_feed_forward;
+}
+
+void SpeedController::set_telemetry_callback(
+    void (*callback)(void* context, const PidBank::Telemetry& telemetry), void* context
+) {
+    this->pid_bank.set_telemetry_callback(callback, context);
+}
+
 void SpeedController::reset() {
-    this->linear_pid.reset();
-    this->angular_pid.reset();
+    this->pid_bank.reset();
+    this->last_linear_speed = 0.0F;
+    this->last_angular_speed = 0.0F;
+    this->last_acceleration = {};
 }
 }  // namespace micras::nav
@@ -42,13 +42,43 @@ core::Vector Pose::to_cell(float cell_size) const {
 RelativePose::RelativePose(const Pose& absolute_pose) : absolute_pose{&absolute_pose} { }
 
 Pose RelativePose::get() const {
+    const core::Vector displacement = this->absolute_pose->position - this->reference_pose.position;
+
     return {
-        this->absolute_pose->position - this->reference_pose.position,
+        {this->reference_cos * displacement.x + this->reference_sin * displacement.y,
+         this->reference_cos * displacement.y - this->reference_sin * displacement.x},
         this->absolute_pose->orientation - this->reference_pose.orientation
     };
 }
 
 void RelativePose::reset_reference() {
     this->reference_pose = *(this->absolute_pose);
+    this->reference_cos = std::cos(this->reference_pose.orientation);
+    this->reference_sin = std::sin(this->reference_pose.orientation);
+}
+
+void RelativePose::continue_reference(const Pose& residual_pose) {
+    this->reference_pose.orientation = this->absolute_pose->orientation - residual_pose.orientation;
+    this->reference_cos = std::cos(this->reference_pose.orientation);
+    this->reference_sin = std::sin(this->reference_pose.orientation);
+    this->reference_pose.position = {
+        this->absolute_pose->position.x - this->reference_cos * residual_pose.position.x +
+            this->reference_sin * residual_pose.position.y,
+        this->absolute_pose->position.y - this->reference_sin * residual_pose.position.x -
+            this->reference_cos * residual_pose.position.y
+    };
+}
+
+core::Vector RelativePose::get_direction() const {
+    return {this->reference_cos, this->reference_sin};
+}
+
+core::Vector RelativePose::to_absolute(const core::Vector& relative_position) const {
+    return {
+        this->reference_pose.position.x + this->reference_cos * relative_position.x -
+            this->reference_sin * relative_position.y,
+        this->reference_pose.position.y + this->reference_sin * relative_position.x +
+            this->reference_cos * relative_position.y
+    };
 }
 }  // namespace micras::nav
@@ -0,0 +1,30 @@
+/**
+ * @file
+ */
+
+#include "micras/core/fastmath.hpp"
+#include "micras/nav/tracking_controller.hpp"
+
+namespace micras::nav {
+TrackingController::TrackingController(const Config& config) :
+    along_gain{config.along_gain}, lateral_gain{config.lateral_gain}, heading_gain{config.heading_gain} { }
+
+Twist TrackingController::compute_speeds(
+    const Pose& pose, const Pose& reference_pose, const Twist& reference_twist
+) const {
+    const auto [sin_orientation, cos_orientation] = core::math::sincos(pose.orientation);
+
+    const core::Vector position_error = reference_pose.position - pose.position;
+    const float        along_error = cos_orientation * position_error.x + sin_orientation * position_error.y;
+    const float        lateral_error = cos_orientation * position_error.y - sin_orientation * position_error.x;
+    const float        heading_error = reference_pose.orientation - pose.orientation;
+
+    const auto [sin_heading_error, cos_heading_error] = core::math::sincos(heading_error);
+    const float angular_correction = this->lateral_gain * lateral_error + this->heading_gain * sin_heading_error;
+
+    return {
+        .linear = reference_twist.linear * cos_heading_error + this->along_gain * along_error,
+        .angular = reference_twist.angular + reference_twist.linear * angular_correction,
+    };
+}
+}  // namespace micras::nav
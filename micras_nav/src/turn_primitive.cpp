@@ -0,0 +1,138 @@
+/**
+ * @file
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include "micras/nav/turn_primitive.hpp"
+
+namespace micras::nav {
+TurnPrimitive::TurnPrimitive(const Config& config) :
+    angle{std::abs(config.angle)},
+    ramp_angle{config.ramp_ratio * std::abs(config.angle)},
+    unit_position_x{0.0F, this->angle + 2.0F * this->ramp_angle, [this](float distance) {
+                        return unit_curve_displacement(this->angle, this->ramp_angle, distance).x;
+                    }},
+    unit_position_y{0.0F, this->angle + 2.0F * this->ramp_angle, [this](float distance) {
+                        return unit_curve_displacement(this->angle, this->ramp_angle, distance).y;
+                    }} {
+    const core::Vector  unit_displacement =
+        unit_curve_displacement(this->angle, this->ramp_angle, this->angle + 2.0F * this->ramp_angle);
+    const core::Vector& displacement = config.displacement;
+    const float         sin_angle = std::sin(this->angle);
+    const float         cos_angle = std::cos(this->angle);
+
+    // The entry and exit lines are parallel, so only the radius changes the lateral displacement
+    if (std::abs(sin_angle) < 0.001F) {
+        this->radius = displacement.y / unit_displacement.y;
+
+        const float offset_difference = displacement.x - this->radius * unit_displacement.x;
+        this->entry_offset = std::max(offset_difference, 0.0F);
+        this->exit_offset = std::max(-offset_difference, 0.0F);
+        return;
+    }
+
+    const float cot_angle = cos_angle / sin_angle;
+
+    this->radius = std::min(
+        (displacement.x - displacement.y * cot_angle) / (unit_displacement.x - unit_displacement.y * cot_angle),
+        displacement.y / unit_displacement.y
+    );
+    this->exit_offset = std::max((displacement.y - this->radius * unit_displacement.y) / sin_angle, 0.0F);
+    this->entry_offset =
+        std::max(displacement.x - this->radius * unit_displacement.x - this->exit_offset * cos_angle, 0.0F);
+}
+
+float TurnPrimitive::get_curvature(float orientation) const {
+    const float ramp_progress = std::min(orientation, this->angle - orientation) / this->ramp_angle;
+
+    if (ramp_progress >= 1.0F or this->ramp_angle == 0.0F) {
+        return 1.0F / this->radius;
+    }
+
+    return std::sqrt(std::max(ramp_progress, 0.0F)) / this->radius;
+}
+
+core::Vector TurnPrimitive::get_position(float orientation) const {
+    const float distance = unit_curve_distance(this->angle, this->ramp_angle, orientation);
+
+    return {
+        this->radius * this->unit_position_x.interpolate(distance),
+        this->radius * this->unit_position_y.interpolate(distance)
+    };
+}
+
+float TurnPrimitive::get_max_speed(float max_centrifugal_acceleration, float max_angular_acceleration) const {
+    const float max_speed = std::sqrt(max_centrifugal_acceleration * this->radius);
+
+    if (this->ramp_angle == 0.0F) {
+        return max_speed;
+    }
+
+    // In the clothoids the angular acceleration is v^2 / (2 * ramp_angle * radius^2)
+    return std::fminf(max_speed, this->radius * std::sqrt(2.0F * this->ramp_angle * max_angular_acceleration));
+}
+
+float TurnPrimitive::get_duration(float linear_speed) const {
+    return this->get_length() / linear_speed;
+}
+
+float TurnPrimitive::get_angle() const {
+    return this->angle;
+}
+
+float TurnPrimitive::get_radius() const {
+    return this->radius;
+}
+
+float TurnPrimitive::get_entry_offset() const {
+    return this->entry_offset;
+}
+
+float TurnPrimitive::get_exit_offset() const {
+    return this->exit_offset;
+}
+
+float TurnPrimitive::get_length() const {
+    return this->radius * (this->angle + 2.0F * this->ramp_angle);
+}
+
+float TurnPrimitive::unit_curve_distance(float angle, float ramp_angle, float orientation) {
+    const float ramp_length = 2.0F * ramp_angle;
+
+    if (orientation < ramp_angle) {
+        return std::sqrt(2.0F * ramp_length * std::max(orientation, 0.0F));
+    }
+
+    if (orientation > angle - ramp_angle) {
+        return angle + ramp_length - std::sqrt(2.0F * ramp_length * std::max(angle - orientation, 0.0F));
+    }
+
+    return orientation - ramp_angle + ramp_length;
+}
+
+core::Vector TurnPrimitive::unit_curve_displacement(float angle, float ramp_angle, float end_distance) {
+    const float  ramp_length = 2.0F * ramp_angle;
+    const float  length = angle + ramp_length;
+    const auto   num_of_steps = static_cast<uint16_t>(std::ceil(integration_steps * end_distance / length));
+    const float  step = num_of_steps > 0 ? end_distance / num_of_steps : 0.0F;
+    core::Vector displacement{0.0F, 0.0F};
+
+    for (uint16_t i = 0; i < num_of_steps; i++) {
+        const float distance = (i + 0.5F) * step;
+        float       orientation = ramp_angle + distance - ramp_length;
+
+        if (distance < ramp_length) {
+            orientation = distance * distance / (2.0F * ramp_length);
+        } else if (distance > length - ramp_length) {
+            orientation = angle - (length - distance) * (length - distance) / (2.0F * ramp_length);
+        }
+
+        displacement.x += step * std::cos(orientation);
+        displacement.y += step * std::sin(orientation);
+    }
+
+    return displacement;
+}
+}  // namespace micras::nav
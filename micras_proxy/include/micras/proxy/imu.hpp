@@ -9,9 +9,12 @@
 #include <cstdint>
 #include <lsm6dsv_reg.h>
 #include <numbers>
+#include <span>
 
 #include "micras/core/butterworth_filter.hpp"
 #include "micras/hal/spi.hpp"
+#include "micras/hal/spi_queue.hpp"
+#include "micras/proxy/imu_fifo.hpp"
 
 namespace micras::proxy {
 /**
@@ -19,6 +22,22 @@ namespace micras::proxy {
  */
 class Imu {
 public:
+    /**
+     * @brief Enum to select how the samples are read from the IMU.
+     */
+    enum ReadMode : uint8_t {
+        REGISTERS = 0,
+        FIFO = 1,
+    };
+
+    /**
+     * @brief Enum to select how the transactions with the IMU are done.
+     */
+    enum TransferMode : uint8_t {
+        BLOCKING = 0,
+        DMA = 1,
+    };
+
     /**
      * @brief IMU configuration struct.
      */
@@ -31,6 +50,9 @@ public:
         lsm6dsv_xl_full_scale_t         accelerometer_scale;
         lsm6dsv_filt_gy_lp1_bandwidth_t gyroscope_filter;
         lsm6dsv_filt_xl_lp2_bandwidth_t accelerometer_filter;
+        ReadMode                        read_mode;
+        TransferMode                    transfer_mode;
+        ImuFifo::Config                 fifo;
     };
 
     /**
@@ -51,9 +73,17 @@ public:
 
     /**
      * @brief Update the IMU data.
+     *
+     * @details In the DMA mode, the samples read in the background since the last update are loaded and the next
+     * ones are requested, so the transfer overlaps with the rest of the loop.
      */
     void update();
 
+    /**
+     * @brief Advance the DMA transfers of the next samples, to be called while the loop waits.
+     */
+    void process_transfers();
+
     /**
      * @brief Get the IMU angular velocity over an axis.
      *
@@ -62,6 +92,17 @@ public:
      */
     float get_angular_velocity(Axis axis) const;
 
+    /**
+     * @brief Get the IMU angular displacement over the Z axis since the last update.
+     *
+     * @details In the FIFO mode, every gyroscope sample is integrated at its timestamp, otherwise the last sample is
+     * held during the elapsed time.
+     *
+     * @param elapsed_time Time since the last update in seconds.
+     * @return Angular displacement over the Z axis in rad.
+     */
+    float get_angular_displacement(float elapsed_time) const;
+
     /**
      * @brief Get the IMU linear acceleration over an axis.
      *
@@ -70,11 +111,32 @@ public:
      */
     float get_linear_acceleration(Axis axis) const;
 
+    /**
+     * @brief Get the temperature of the IMU.
+     *
+     * @return Temperature in Celsius.
+     */
+    float get_temperature() const;
+
     /**
      * @brief Define the base reading to be removed from the IMU value.
      */
     void calibrate();
 
+    /**
+     * @brief Get the bias removed from the angular velocity over the Z axis.
+     *
+     * @return Gyroscope bias in rad/s.
+     */
+    float get_gyro_bias() const;
+
+    /**
+     * @brief Set the bias removed from the angular velocity over the Z axis, replacing the calibration.
+     *
+     * @param bias Gyroscope bias in rad/s.
+     */
+    void set_gyro_bias(float bias);
+
     /**
      * @brief Check if IMU was initialized.
      *
@@ -83,6 +145,50 @@ public:
     bool was_initialized() const;
 
 private:
+    /**
+     * @brief Read the latest samples from the data registers.
+     */
+    void update_registers();
+
+    /**
+     * @brief Read the samples batched in the FIFO since the last update.
+     */
+    void update_fifo();
+
+    /**
+     * @brief Load the samples decoded by the FIFO.
+     */
+    void load_fifo_samples();
+
+    /**
+     * @brief Queue the DMA transactions reading the next samples.
+     */
+    void request_samples();
+
+    /**
+     * @brief Decode the data registers read using DMA.
+     *
+     * @param context Pointer to the IMU object.
+     * @param rx_data Received data, starting with the dummy byte of the address.
+     */
+    static void on_registers_read(void* context, std::span<uint8_t> rx_data);
+
+    /**
+     * @brief Queue the burst read of the FIFO after its status was read using DMA.
+     *
+     * @param context Pointer to the IMU object.
+     * @param rx_data Received data, starting with the dummy byte of the address.
+     */
+    static void on_fifo_status_read(void* context, std::span<uint8_t> rx_data);
+
+    /**
+     * @brief Decode the FIFO words read using DMA.
+     *
+     * @param context Pointer to the IMU object.
+     * @param rx_data Received data, starting with the dummy byte of the address.
+     */
+    static void on_fifo_read(void* context, std::span<uint8_t> rx_data);
+
     /**
      * @brief Check the IMU device.
      *
@@ -138,6 +244,11 @@ private:
      */
     std::array<float, 3> linear_acceleration{};
 
+    /**
+     * @brief Current temperature in Celsius.
+     */
+    float temperature{};
+
     /**
      * @brief Gyroscope conversion factor.
      */
@@ -148,11 +259,62 @@ private:
      */
     float xl_factor;
 
+    /**
+     * @brief How the samples are read from the IMU.
+     */
+    ReadMode read_mode;
+
+    /**
+     * @brief FIFO of the IMU, used in the FIFO mode.
+     */
+    ImuFifo fifo;
+
+    /**
+     * @brief How the transactions with the IMU are done.
+     */
+    TransferMode transfer_mode;
+
+    /**
+     * @brief Queue of the DMA transactions with the IMU.
+     */
+    hal::TSpiQueue<hal::Spi, 2> spi_queue;
+
+    /**
+     * @brief Buffers for the DMA transactions, with the address byte followed by the largest FIFO burst.
+     */
+    std::array<uint8_t, 1 + ImuFifo::word_size * ImuFifo::max_words> tx_buffer{};
+    std::array<uint8_t, 1 + ImuFifo::word_size * ImuFifo::max_words> rx_buffer{};
+
+    /**
+     * @brief Angular displacement over the Z axis integrated from the FIFO in the last update.
+     */
+    float angular_displacement{};
+
+    /**
+     * @brief Time spanned by the gyroscope samples integrated from the FIFO in the last update.
+     */
+    float integration_time{};
+
+    /**
+     * @brief Angular displacement integrated from the FIFO since the last update.
+     */
+    float pending_angular_displacement{};
+
+    /**
+     * @brief Time spanned by the gyroscope samples integrated from the FIFO since the last update.
+     */
+    float pending_integration_time{};
+
     /**
      * @brief Gyroscope Butterworth filter for the calibration.
      */
     core::ButterworthFilter calibration_filter{5.0F};
 
+    /**
+     * @brief Bias removed from the angular velocity over the Z axis.
+     */
+    float gyro_bias{};
+
     /**
      * @brief Flag to check if the IMU was calibrated.
      */
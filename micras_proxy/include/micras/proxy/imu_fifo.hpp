@@ -0,0 +1,235 @@
+/**
+ * @file
+ */
+
+#ifndef MICRAS_PROXY_IMU_FIFO_HPP
+#define MICRAS_PROXY_IMU_FIFO_HPP
+
+#include <array>
+#include <cstdint>
+#include <lsm6dsv_reg.h>
+#include <span>
+
+namespace micras::proxy {
+/**
+ * @brief Class for draining the FIFO of the IMU.
+ *
+ * @details The gyroscope and accelerometer samples are batched with a timestamp, so every gyroscope sample is
+ * integrated at the time it was taken, even when the loop is late or more than one sample arrived since the last
+ * update. The whole FIFO content is read in a single burst transaction.
+ */
+class ImuFifo {
+public:
+    /**
+     * @brief IMU FIFO configuration struct.
+     */
+    struct Config {
+        lsm6dsv_fifo_gy_batch_t   gyroscope_batch_rate;
+        lsm6dsv_fifo_xl_batch_t   accelerometer_batch_rate;
+        lsm6dsv_fifo_temp_batch_t temperature_batch_rate;
+    };
+
+    /**
+     * @brief Size of a FIFO word, with the tag byte and six data bytes.
+     */
+    static constexpr uint8_t word_size{7};
+
+    /**
+     * @brief Maximum number of words read in a single update, the rest being read in the next one.
+     */
+    static constexpr uint16_t max_words{64};
+
+    /**
+     * @brief Construct a new ImuFifo object.
+     *
+     * @param dev_ctx Device context for the IMU library.
+     * @param config Configuration for the FIFO.
+     * @param gy_factor Gyroscope conversion factor to rad/s.
+     * @param xl_factor Accelerometer conversion factor to m/s².
+     */
+    ImuFifo(stmdev_ctx_t& dev_ctx, const Config& config, float gy_factor, float xl_factor);
+
+    /**
+     * @brief Configure the IMU to batch the samples in the FIFO.
+     */
+    void configure();
+
+    /**
+     * @brief Read and decode the samples stored in the FIFO since the last update.
+     */
+    void update();
+
+    /**
+     * @brief Decode the samples of a burst read from the FIFO output registers.
+     *
+     * @param data Words read from the FIFO.
+     */
+    void decode(std::span<const uint8_t> data);
+
+    /**
+     * @brief Get the number of words to read from the FIFO.
+     *
+     * @param status Values of the two FIFO status registers.
+     * @return Number of words stored in the FIFO, limited to the maximum read at once.
+     */
+    static uint16_t get_num_of_words(std::span<const uint8_t, 2> status);
+
+    /**
+     * @brief Get the angular displacement over each axis since the last update.
+     *
+     * @return Angular displacement over the X, Y and Z axes in rad.
+     */
+    const std::array<float, 3>& get_angular_displacement() const;
+
+    /**
+     * @brief Get the mean linear acceleration over each axis since the last update.
+     *
+     * @return Linear acceleration over the X, Y and Z axes in m/s².
+     */
+    const std::array<float, 3>& get_linear_acceleration() const;
+
+    /**
+     * @brief Get the time spanned by the gyroscope samples integrated in the last update.
+     *
+     * @return Integration time in seconds, according to the IMU clock.
+     */
+    float get_integration_time() const;
+
+    /**
+     * @brief Get the last temperature batched in the FIFO.
+     *
+     * @return Temperature in Celsius.
+     */
+    float get_temperature() const;
+
+    /**
+     * @brief Get the number of gyroscope samples read in the last update.
+     *
+     * @return Number of gyroscope samples.
+     */
+    uint16_t get_num_of_gyroscope_samples() const;
+
+    /**
+     * @brief Get the number of accelerometer samples read in the last update.
+     *
+     * @return Number of accelerometer samples.
+     */
+    uint16_t get_num_of_accelerometer_samples() const;
+
+private:
+    /**
+     * @brief Duration of a timestamp unit in seconds.
+     */
+    static constexpr float timestamp_resolution{21.75e-6F};
+
+    /**
+     * @brief Sensor tags of the FIFO words.
+     */
+    enum Tag : uint8_t {
+        GYROSCOPE = 0x01,
+        ACCELEROMETER = 0x02,
+        TEMPERATURE = 0x03,
+        TIMESTAMP = 0x04,
+    };
+
+    /**
+     * @brief Decode a 16 bits value of a FIFO word.
+     *
+     * @param word FIFO word with the tag followed by the data.
+     * @param index Index of the value in the data.
+     * @return Decoded value.
+     */
+    static int16_t get_value(std::span<const uint8_t, word_size> word, uint8_t index);
+
+    /**
+     * @brief Integrate a gyroscope sample.
+     *
+     * @param word FIFO word of the sample.
+     */
+    void process_gyroscope(std::span<const uint8_t, word_size> word);
+
+    /**
+     * @brief Accumulate an accelerometer sample.
+     *
+     * @param word FIFO word of the sample.
+     */
+    void process_accelerometer(std::span<const uint8_t, word_size> word);
+
+    /**
+     * @brief Device context for the IMU library.
+     */
+    stmdev_ctx_t& dev_ctx;
+
+    /**
+     * @brief Batch rates of the sensors.
+     */
+    Config config;
+
+    /**
+     * @brief Gyroscope conversion factor.
+     */
+    float gy_factor;
+
+    /**
+     * @brief Accelerometer conversion factor.
+     */
+    float xl_factor;
+
+    /**
+     * @brief Buffer for the burst read of the FIFO.
+     */
+    std::array<uint8_t, word_size * max_words> buffer{};
+
+    /**
+     * @brief Angular displacement integrated since the last update.
+     */
+    std::array<float, 3> angular_displacement{};
+
+    /**
+     * @brief Mean linear acceleration since the last update.
+     */
+    std::array<float, 3> linear_acceleration{};
+
+    /**
+     * @brief Last gyroscope sample, kept to integrate across updates.
+     */
+    std::array<float, 3> last_angular_velocity{};
+
+    /**
+     * @brief Last timestamp read from the FIFO.
+     */
+    uint32_t timestamp{};
+
+    /**
+     * @brief Timestamp of the last gyroscope sample.
+     */
+    uint32_t last_gyroscope_timestamp{};
+
+    /**
+     * @brief Time spanned by the gyroscope samples integrated in the last update.
+     */
+    float integration_time{};
+
+    /**
+     * @brief Last temperature batched in the FIFO.
+     */
+    float temperature{};
+
+    /**
+     * @brief Number of gyroscope samples read in the last update.
+     */
+    uint16_t num_of_gyroscope_samples{};
+
+    /**
+     * @brief Number of accelerometer samples read in the last update.
+     */
+    uint16_t num_of_accelerometer_samples{};
+
+    /**
+     * @brief Flag to check if a gyroscope sample was already read.
+     */
+    bool has_gyroscope_sample{};
+};
+}  // namespace micras::proxy
+
+#endif  // MICRAS_PROXY_IMU_FIFO_HPP
@@ -6,9 +6,11 @@
 #define MICRAS_PROXY_ROTARY_SENSOR_HPP
 
 #include <cstdint>
+#include <optional>
 
 #include "micras/hal/crc.hpp"
 #include "micras/hal/encoder.hpp"
+#include "micras/hal/input_capture.hpp"
 #include "micras/hal/spi.hpp"
 
 namespace micras::proxy {
@@ -23,11 +25,12 @@ public:
      * @brief Rotary sensor configuration struct.
      */
     struct Config {
-        hal::Spi::Config     spi;
-        hal::Encoder::Config encoder;
-        hal::Crc::Config     crc;
-        uint32_t             resolution;
-        Registers            registers;
+        hal::Spi::Config                         spi;
+        hal::Encoder::Config                     encoder;
+        std::optional<hal::InputCapture::Config> edge_capture;
+        hal::Crc::Config                         crc;
+        uint32_t                                 resolution;
+        Registers                                registers;
     };
 
     union CommandFrame {
@@ -68,6 +71,20 @@ public:
      */
     float get_position() const;
 
+    /**
+     * @brief Get the time since the last edge counted by the encoder.
+     *
+     * @return Time since the last edge in seconds, or zero if the edges are not captured.
+     */
+    float get_edge_age() const;
+
+    /**
+     * @brief Get the position change of a single count of the encoder.
+     *
+     * @return Position step in radians.
+     */
+    float get_position_step() const;
+
     /**
      * @brief Read a register to the rotary sensor.
      *
@@ -94,6 +111,11 @@ private:
      */
     hal::Encoder encoder;
 
+    /**
+     * @brief Input capture timing the edges of the encoder, if it is wired.
+     */
+    std::optional<hal::InputCapture> edge_capture;
+
     /**
      * @brief CRC for the rotary sensor configuration.
      */
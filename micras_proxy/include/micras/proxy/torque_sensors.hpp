@@ -8,7 +8,7 @@
 #include <array>
 #include <cstdint>
 
-#include "micras/core/butterworth_filter.hpp"
+#include "micras/core/biquad_filter_bank.hpp"
 #include "micras/hal/adc_dma.hpp"
 
 namespace micras::proxy {
@@ -25,7 +25,7 @@ public:
         hal::AdcDma::Config adc;
         float               shunt_resistor;
         float               max_torque;
-        float               filter_cutoff;
+        core::FilterDesign  filter;
     };
 
     /**
@@ -112,9 +112,9 @@ private:
     float max_torque;
 
     /**
-     * @brief Butterworth filters for the torque reading.
+     * @brief Butterworth filters for the torque readings.
      */
-    std::array<core::ButterworthFilter, num_of_sensors> filters;
+    core::TBiquadFilterBank<num_of_sensors> filters;
 };
 }  // namespace micras::proxy
 
@@ -6,29 +6,87 @@
 #define MICRAS_PROXY_WALL_SENSORS_HPP
 
 #include <array>
+#include <atomic>
 #include <cstdint>
+#include <span>
+#include <vector>
 
-#include "micras/core/butterworth_filter.hpp"
+#include "micras/core/lookup_table.hpp"
+#include "micras/core/serializable.hpp"
+#include "micras/core/speed_adaptive_filter.hpp"
 #include "micras/hal/adc_dma.hpp"
 #include "micras/hal/pwm.hpp"
+#include "micras/hal/timer.hpp"
 
 namespace micras::proxy {
 /**
  * @brief Class for controlling Wall Sensors.
+ *
+ * @details The readings are converted to distances by a table for each sensor, which is serialized with the base
+ * readings to keep its calibration in the storage. The tables take the square root of the ratio between the base
+ * reading and the reading, which is proportional to the distance if the reflected light decays with its square, as the
+ * uncalibrated tables assume. The calibration then only corrects the deviations from this law, and recalibrating the
+ * base readings still compensates the reflectivity of the walls.
+ *
+ * The ADC conversions are triggered at the start of each emitter period, converting every sensor once while the
+ * emitters are lit and once while they are not. The DMA fills the two halves of a circular buffer, each with a frame
+ * of the configured number of emitter periods, and the interrupt of each half averages the lit readings minus the
+ * unlit ones over its periods, which rejects the ambient light, and timestamps them.
+ *
+ * The emitters are time multiplexed in slots of one frame each, lighting only their emitters and updating only their
+ * receivers, so a receiver does not see the light of the emitters of other slots reflected by other walls. The
+ * interrupt of each frame sets the emitters of the next slot, which the timer applies at the start of its period.
  */
 template <uint8_t num_of_sensors>
-class TWallSensors {
+class TWallSensors : public core::ISerializable {
 public:
+    /**
+     * @brief Number of entries of the distance tables.
+     */
+    static constexpr uint16_t distance_table_size{32};
+
+    /**
+     * @brief Maximum number of emitter periods averaged in each frame.
+     */
+    static constexpr uint8_t max_oversampling{4};
+
+    /**
+     * @brief Maximum number of emitter slots.
+     */
+    static constexpr uint8_t max_num_of_slots{2};
+
+    /**
+     * @brief Configuration of an emitter slot.
+     */
+    struct EmitterSlot {
+        float                            led_0_duty_cycle;
+        float                            led_1_duty_cycle;
+        std::array<bool, num_of_sensors> sensors;
+    };
+
+    /**
+     * @brief Type to store a reading measured at a known distance from the wall.
+     */
+    struct DistanceSample {
+        float reading;
+        float distance;
+    };
+
     /**
      * @brief Configuration struct for wall sensors.
      */
     struct Config {
-        hal::AdcDma::Config               adc;
-        hal::Pwm::Config                  led_0_pwm;
-        hal::Pwm::Config                  led_1_pwm;
-        float                             filter_cutoff;
-        std::array<float, num_of_sensors> base_readings;
-        float                             uncertainty;
+        hal::AdcDma::Config                       adc;
+        hal::Pwm::Config                          led_0_pwm;
+        hal::Pwm::Config                          led_1_pwm;
+        hal::Timer::Config                        timer;
+        uint8_t                                   oversampling;
+        std::array<EmitterSlot, max_num_of_slots> emitter_slots;
+        uint8_t                                   num_of_slots;
+        core::SpeedAdaptiveFilter::Config         filter;
+        std::array<float, num_of_sensors>         base_readings;
+        std::array<float, num_of_sensors>         base_distances;
+        float                                     uncertainty;
     };
 
     /**
@@ -49,18 +107,19 @@ public:
     void turn_off();
 
     /**
-     * @brief Update the wall sensors readings.
+     * @brief Update the wall sensors readings with the latest complete frame, if there is a new one.
+     *
+     * @param linear_speed Current linear speed of the robot in m/s, adapting the cutoff of the filters.
      */
-    void update();
+    void update(float linear_speed = 0.0F);
 
     /**
      * @brief Get the observation from a sensor.
      *
      * @param sensor_index Index of the sensor.
-     * @param disturbed Whether or not there is another wall perpendicular to the one being measured.
      * @return True if the sensor detects a wall, false otherwise.
      */
-    bool get_wall(uint8_t sensor_index, bool disturbed = false) const;
+    bool get_wall(uint8_t sensor_index) const;
 
     /**
      * @brief Get the reading from a sensor.
@@ -74,10 +133,31 @@ public:
      * @brief Get the ADC reading from a sensor.
      *
      * @param sensor_index Index of the sensor.
-     * @return ADC reading from the sensor from 0 to 1.
+     * @return ADC reading from the sensor in the last frame, without the ambient light, from 0 to 1.
      */
     float get_adc_reading(uint8_t sensor_index) const;
 
+    /**
+     * @brief Get the distance travelled during the delay of the filtered readings.
+     *
+     * @return Delay of the filters in meters at the speed of the last update.
+     */
+    float get_lag() const;
+
+    /**
+     * @brief Get the number of the frame used in the last update.
+     *
+     * @return Number of frames completed until the one used, zero if there was none.
+     */
+    uint32_t get_frame_number() const;
+
+    /**
+     * @brief Get the time when the frame used in the last update was completed.
+     *
+     * @return Microseconds timer counter at the completion of the frame.
+     */
+    uint32_t get_frame_timestamp() const;
+
     /**
      * @brief Get the deviation of a wall sensor reading from its calibrated baseline.
      *
@@ -86,12 +166,112 @@ public:
      */
     float get_sensor_error(uint8_t sensor_index) const;
 
+    /**
+     * @brief Get the distance from a sensor to the wall.
+     *
+     * @param sensor_index Index of the sensor.
+     * @return Distance to the wall in meters, saturated at the range of the table, or infinite if nothing is seen.
+     */
+    float get_distance(uint8_t sensor_index) const;
+
+    /**
+     * @brief Get the deviation of the distance to the wall from the calibrated base distance.
+     *
+     * @param sensor_index Index of the sensor.
+     * @return The distance error in meters; positive if the wall is further than at calibration.
+     */
+    float get_distance_error(uint8_t sensor_index) const;
+
     /**
      * @brief Calibrate a wall sensor base reading.
      */
     void calibrate_sensor(uint8_t sensor_index);
 
+    /**
+     * @brief Fit the distance table of a sensor to the readings of a calibration sweep.
+     *
+     * @param sensor_index Index of the sensor.
+     * @param samples Readings measured at known distances, relative to the current base reading.
+     * @return True if the table was fitted, false if the sweep covers too little of it.
+     */
+    bool calibrate_distance_table(uint8_t sensor_index, std::span<const DistanceSample> samples);
+
+    /**
+     * @brief Serialize the base readings and the distance tables.
+     *
+     * @return Serialized data.
+     */
+    std::vector<uint8_t> serialize() const override;
+
+    /**
+     * @brief Deserialize the base readings and the distance tables.
+     *
+     * @param buffer Serialized data.
+     * @param size Size of the serialized data.
+     *
+     * @details The tables are indexed by the readings relative to the base readings, so they are only restored
+     * together, and a record missing either of them is discarded.
+     */
+    void deserialize(const uint8_t* buffer, uint16_t size) override;
+
 private:
+    /**
+     * @brief Type of the tables converting the normalized readings to distances.
+     */
+    using DistanceTable = core::TLookupTable<distance_table_size>;
+
+    /**
+     * @brief Range of the square root of the ratio between the base reading and the reading covered by the tables.
+     */
+    ///@{
+    static constexpr float min_normalized_reading{0.25F};
+    static constexpr float max_normalized_reading{4.0F};
+    ///@}
+
+    /**
+     * @brief Get the input of the distance table of a sensor for a reading.
+     *
+     * @param sensor_index Index of the sensor.
+     * @param reading Reading from the sensor.
+     * @return Square root of the ratio between the base reading and the reading.
+     */
+    float normalize_reading(uint8_t sensor_index, float reading) const;
+
+    /**
+     * @brief Average the readings of the emitter periods in a half of the buffer.
+     *
+     * @param half Index of the half of the buffer.
+     * @return ADC readings of the sensors without the ambient light, from 0 to 1.
+     */
+    std::array<float, num_of_sensors> decimate_frame(uint8_t half) const;
+
+    /**
+     * @brief Set the duty cycles of the emitters of a slot.
+     *
+     * @param slot Index of the slot.
+     */
+    void set_slot_emitters(uint8_t slot);
+
+    /**
+     * @brief Publish a completed frame and set the emitters of the next slot, called from the DMA interrupt.
+     *
+     * @param context Pointer to the wall sensors.
+     * @param half Index of the half of the buffer with the frame.
+     *
+     * @details If the next period already started when the interrupt runs, the emitters of the next slot are only
+     * applied during its frame, so that frame is discarded.
+     */
+    static void on_frame_completed(void* context, uint8_t half);
+
+    /**
+     * @brief Create the uncalibrated distance tables, with the distances proportional to the normalized readings.
+     *
+     * @param base_distances Distances to the wall at which the base readings are measured.
+     * @return Distance tables of the sensors.
+     */
+    static std::array<DistanceTable, num_of_sensors>
+        make_distance_tables(const std::array<float, num_of_sensors>& base_distances);
+
     /**
      * @brief ADC DMA handle.
      */
@@ -108,20 +288,100 @@ private:
     hal::Pwm led_1_pwm;
 
     /**
-     * @brief Buffer to store the ADC values.
+     * @brief Timer to timestamp the frames.
      */
-    std::array<uint16_t, 2 * num_of_sensors> buffer;
+    hal::Timer timer;
 
     /**
-     * @brief Butterworth filter for the ADC readings.
+     * @brief Number of emitter periods averaged in each frame.
      */
-    std::array<core::ButterworthFilter, num_of_sensors> filters;
+    uint8_t oversampling;
+
+    /**
+     * @brief Buffer to store the ADC values, with a frame in each half and the unlit readings after the lit ones.
+     */
+    std::array<uint16_t, 2 * max_oversampling * 2 * num_of_sensors> buffer{};
+
+    /**
+     * @brief Emitter slots, lit one per frame.
+     */
+    std::array<EmitterSlot, max_num_of_slots> emitter_slots;
+
+    /**
+     * @brief Number of emitter slots.
+     */
+    uint8_t num_of_slots;
+
+    /**
+     * @brief Flag to check if the emitters are turned on.
+     */
+    std::atomic<bool> emitting{};
+
+    /**
+     * @brief Slot lit during the current frame, used by the DMA interrupt.
+     */
+    uint8_t frame_slot{};
+
+    /**
+     * @brief Flag to check if the current frame is lit by the emitters of its slot, used by the DMA interrupt.
+     */
+    bool valid_frame{};
+
+    /**
+     * @brief ADC readings of the last frame sampling each sensor, written by the DMA interrupt.
+     */
+    std::array<float, num_of_sensors> published_readings{};
+
+    /**
+     * @brief Number of published frames, written by the DMA interrupt.
+     */
+    std::atomic<uint32_t> num_of_completed_frames{};
+
+    /**
+     * @brief Time when the last frame was completed, written by the DMA interrupt.
+     */
+    std::atomic<uint32_t> completion_timestamp{};
+
+    /**
+     * @brief Number of the frame used in the last update.
+     */
+    uint32_t frame_number{};
+
+    /**
+     * @brief Time when the frame used in the last update was completed.
+     */
+    uint32_t frame_timestamp{};
+
+    /**
+     * @brief ADC readings of the frame used in the last update, without the ambient light.
+     */
+    std::array<float, num_of_sensors> adc_readings{};
+
+    /**
+     * @brief Filters for the ADC readings, keeping the same delay in distance at any speed.
+     */
+    std::array<core::SpeedAdaptiveFilter, num_of_sensors> filters;
 
     /**
      * @brief Measured wall values during calibration.
      */
     std::array<float, num_of_sensors> base_readings;
 
+    /**
+     * @brief Distances to the wall at which the base readings are measured.
+     */
+    std::array<float, num_of_sensors> base_distances;
+
+    /**
+     * @brief Tables converting the normalized readings to distances.
+     */
+    std::array<DistanceTable, num_of_sensors> distance_tables;
+
+    /**
+     * @brief Distances to the wall calculated in the last update.
+     */
+    std::array<float, num_of_sensors> distances{};
+
     /**
      * @brief Ratio of the base reading to still consider as seeing a wall.
      */
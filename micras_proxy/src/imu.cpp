@@ -14,7 +14,10 @@ Imu::Imu(const Config& config) :
         mdps_to_radps * 4.375F *
         (1 << (config.gyroscope_scale == LSM6DSV_4000dps ? 5 : static_cast<uint8_t>(config.gyroscope_scale)))
     },
-    xl_factor{mg_to_mps2 * (0.061F * (1 << static_cast<uint8_t>(config.accelerometer_scale)))} {
+    xl_factor{mg_to_mps2 * (0.061F * (1 << static_cast<uint8_t>(config.accelerometer_scale)))},
+    read_mode{config.read_mode},
+    fifo{this->dev_ctx, config.fifo, this->gy_factor, this->xl_factor},
+    transfer_mode{config.transfer_mode} {
     this->dev_ctx.read_reg = platform_read;
     this->dev_ctx.write_reg = platform_write;
     this->dev_ctx.handle = &this->spi;
@@ -47,6 +50,11 @@ Imu::Imu(const Config& config) :
     lsm6dsv_filt_gy_lp1_bandwidth_set(&(this->dev_ctx), config.gyroscope_filter);
     lsm6dsv_filt_xl_lp2_set(&(this->dev_ctx), PROPERTY_ENABLE);
     lsm6dsv_filt_xl_lp2_bandwidth_set(&(this->dev_ctx), config.accelerometer_filter);
+
+    if (this->read_mode == ReadMode::FIFO) {
+        this->fifo.configure();
+    }
+
     this->initialized = true;
 }
 
@@ -59,6 +67,33 @@ bool Imu::check_whoami() {
 }
 
 void Imu::update() {
+    if (this->transfer_mode == TransferMode::DMA) {
+        this->spi_queue.process();
+    } else if (this->read_mode == ReadMode::FIFO) {
+        this->update_fifo();
+    } else {
+        this->update_registers();
+    }
+
+    this->angular_displacement = this->pending_angular_displacement;
+    this->integration_time = this->pending_integration_time;
+    this->pending_angular_displacement = 0.0F;
+    this->pending_integration_time = 0.0F;
+
+    if (not this->calibrated) {
+        this->gyro_bias = this->calibration_filter.update(this->angular_velocity[2]);
+    }
+
+    if (this->transfer_mode == TransferMode::DMA and this->spi_queue.is_idle()) {
+        this->request_samples();
+    }
+}
+
+void Imu::process_transfers() {
+    this->spi_queue.process();
+}
+
+void Imu::update_registers() {
     std::array<int16_t, 3> raw_data{};
     lsm6dsv_all_sources_t  all_sources;
     lsm6dsv_all_sources_get(&dev_ctx, &all_sources);
@@ -77,9 +112,99 @@ void Imu::update() {
         this->angular_velocity[2] = raw_data[2] * gy_factor;
     }
 
-    if (not this->calibrated) {
-        this->calibration_filter.update(this->angular_velocity[2]);
+    if (all_sources.drdy_temp) {
+        int16_t raw_temperature{};
+        lsm6dsv_temperature_raw_get(&dev_ctx, &raw_temperature);
+        this->temperature = lsm6dsv_from_lsb_to_celsius(raw_temperature);
+    }
+}
+
+void Imu::update_fifo() {
+    this->fifo.update();
+    this->load_fifo_samples();
+}
+
+void Imu::load_fifo_samples() {
+    // Without new samples, the last velocities are held, like in the registers mode
+    if (this->fifo.get_integration_time() > 0.0F) {
+        for (uint8_t axis = 0; axis < 3; axis++) {
+            this->angular_velocity.at(axis) =
+                this->fifo.get_angular_displacement().at(axis) / this->fifo.get_integration_time();
+        }
+    }
+
+    if (this->fifo.get_num_of_accelerometer_samples() > 0) {
+        this->linear_acceleration = this->fifo.get_linear_acceleration();
     }
+
+    this->temperature = this->fifo.get_temperature();
+    this->pending_angular_displacement += this->fifo.get_angular_displacement()[2];
+    this->pending_integration_time += this->fifo.get_integration_time();
+}
+
+void Imu::request_samples() {
+    if (this->read_mode == ReadMode::FIFO) {
+        this->tx_buffer[0] = LSM6DSV_FIFO_STATUS1 | 0x80;
+        this->spi_queue.push(
+            {.device = &this->spi,
+             .tx_data = {this->tx_buffer.data(), 3},
+             .rx_data = {this->rx_buffer.data(), 3},
+             .callback = on_fifo_status_read,
+             .context = this}
+        );
+        return;
+    }
+
+    // The temperature, gyroscope and accelerometer registers are contiguous, so they are read in a single burst
+    this->tx_buffer[0] = LSM6DSV_OUT_TEMP_L | 0x80;
+    this->spi_queue.push(
+        {.device = &this->spi,
+         .tx_data = {this->tx_buffer.data(), 15},
+         .rx_data = {this->rx_buffer.data(), 15},
+         .callback = on_registers_read,
+         .context = this}
+    );
+}
+
+void Imu::on_registers_read(void* context, std::span<uint8_t> rx_data) {
+    auto*                  imu = static_cast<Imu*>(context);
+    std::array<int16_t, 7> raw_data{};
+
+    for (uint8_t i = 0; i < raw_data.size(); i++) {
+        raw_data.at(i) = static_cast<int16_t>(rx_data[1 + 2 * i] | (rx_data[2 + 2 * i] << 8));
+    }
+
+    imu->temperature = lsm6dsv_from_lsb_to_celsius(raw_data[0]);
+
+    for (uint8_t axis = 0; axis < 3; axis++) {
+        imu->angular_velocity.at(axis) = raw_data.at(1 + axis) * imu->gy_factor;
+        imu->linear_acceleration.at(axis) = raw_data.at(4 + axis) * imu->xl_factor;
+    }
+}
+
+void Imu::on_fifo_status_read(void* context, std::span<uint8_t> rx_data) {
+    auto*          imu = static_cast<Imu*>(context);
+    const uint16_t num_of_bytes = ImuFifo::get_num_of_words(rx_data.subspan<1, 2>()) * ImuFifo::word_size;
+
+    if (num_of_bytes == 0) {
+        return;
+    }
+
+    imu->tx_buffer[0] = LSM6DSV_FIFO_DATA_OUT_TAG | 0x80;
+    imu->spi_queue.push(
+        {.device = &imu->spi,
+         .tx_data = {imu->tx_buffer.data(), 1U + num_of_bytes},
+         .rx_data = {imu->rx_buffer.data(), 1U + num_of_bytes},
+         .callback = on_fifo_read,
+         .context = imu}
+    );
+}
+
+void Imu::on_fifo_read(void* context, std::span<uint8_t> rx_data) {
+    auto* imu = static_cast<Imu*>(context);
+
+    imu->fifo.decode(rx_data.subspan(1));
+    imu->load_fifo_samples();
 }
 
 float Imu::get_angular_velocity(Axis axis) const {
@@ -91,13 +216,21 @@ float Imu::get_angular_velocity(Axis axis) const {
             return this->angular_velocity[1];
 
         case Axis::Z:
-            return this->angular_velocity[2] - this->calibration_filter.get_last();
+            return this->angular_velocity[2] - this->gyro_bias;
 
         default:
             return 0.0F;
     }
 }
 
+float Imu::get_angular_displacement(float elapsed_time) const {
+    if (this->read_mode == ReadMode::FIFO) {
+        return this->angular_displacement - this->gyro_bias * this->integration_time;
+    }
+
+    return this->get_angular_velocity(Axis::Z) * elapsed_time;
+}
+
 float Imu::get_linear_acceleration(Axis axis) const {
     switch (axis) {
         case Axis::X:
@@ -139,10 +272,23 @@ int32_t Imu::platform_write(void* handle, uint8_t reg, const uint8_t* bufp, uint
     return 0;
 }
 
+float Imu::get_temperature() const {
+    return this->temperature;
+}
+
 void Imu::calibrate() {
     this->calibrated = true;
 }
 
+float Imu::get_gyro_bias() const {
+    return this->gyro_bias;
+}
+
+void Imu::set_gyro_bias(float bias) {
+    this->gyro_bias = bias;
+    this->calibrated = true;
+}
+
 bool Imu::was_initialized() const {
     return this->initialized;
 }
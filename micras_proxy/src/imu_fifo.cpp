@@ -0,0 +1,149 @@
+/**
+ * @file
+ */
+
+#include <algorithm>
+
+#include "micras/proxy/imu_fifo.hpp"
+
+namespace micras::proxy {
+ImuFifo::ImuFifo(stmdev_ctx_t& dev_ctx, const Config& config, float gy_factor, float xl_factor) :
+    dev_ctx{dev_ctx}, config{config}, gy_factor{gy_factor}, xl_factor{xl_factor} { }
+
+void ImuFifo::configure() {
+    lsm6dsv_fifo_mode_set(&(this->dev_ctx), LSM6DSV_BYPASS_MODE);
+
+    lsm6dsv_fifo_gy_batch_set(&(this->dev_ctx), this->config.gyroscope_batch_rate);
+    lsm6dsv_fifo_xl_batch_set(&(this->dev_ctx), this->config.accelerometer_batch_rate);
+    lsm6dsv_fifo_temp_batch_set(&(this->dev_ctx), this->config.temperature_batch_rate);
+
+    // A timestamp is batched with every sample of the fastest sensor, which must be the gyroscope
+    lsm6dsv_timestamp_set(&(this->dev_ctx), PROPERTY_ENABLE);
+    lsm6dsv_fifo_timestamp_batch_set(&(this->dev_ctx), LSM6DSV_TMSTMP_DEC_1);
+
+    lsm6dsv_fifo_mode_set(&(this->dev_ctx), LSM6DSV_STREAM_MODE);
+}
+
+void ImuFifo::update() {
+    std::array<uint8_t, 2> status{};
+    lsm6dsv_read_reg(&(this->dev_ctx), LSM6DSV_FIFO_STATUS1, status.data(), status.size());
+
+    const auto num_of_bytes = static_cast<uint16_t>(get_num_of_words(status) * word_size);
+
+    // The register address rolls back to the tag after each word, so the FIFO is drained in a single burst
+    if (num_of_bytes > 0) {
+        lsm6dsv_read_reg(&(this->dev_ctx), LSM6DSV_FIFO_DATA_OUT_TAG, this->buffer.data(), num_of_bytes);
+    }
+
+    this->decode({this->buffer.data(), num_of_bytes});
+}
+
+void ImuFifo::decode(std::span<const uint8_t> data) {
+    this->angular_displacement = {};
+    this->linear_acceleration = {};
+    this->integration_time = 0.0F;
+    this->num_of_gyroscope_samples = 0;
+    this->num_of_accelerometer_samples = 0;
+
+    const auto num_of_words = static_cast<uint16_t>(data.size() / word_size);
+
+    for (uint16_t i = 0; i < num_of_words; i++) {
+        const std::span<const uint8_t, word_size> word{data.subspan(i * word_size, word_size)};
+
+        switch (word[0] >> 3) {
+            case Tag::GYROSCOPE:
+                this->process_gyroscope(word);
+                break;
+
+            case Tag::ACCELEROMETER:
+                this->process_accelerometer(word);
+                break;
+
+            case Tag::TEMPERATURE:
+                this->temperature = lsm6dsv_from_lsb_to_celsius(get_value(word, 0));
+                break;
+
+            case Tag::TIMESTAMP:
+                this->timestamp = static_cast<uint32_t>(word[1]) | (static_cast<uint32_t>(word[2]) << 8) |
+                                  (static_cast<uint32_t>(word[3]) << 16) | (static_cast<uint32_t>(word[4]) << 24);
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    if (this->num_of_accelerometer_samples > 0) {
+        for (auto& acceleration : this->linear_acceleration) {
+            acceleration /= this->num_of_accelerometer_samples;
+        }
+    }
+}
+
+uint16_t ImuFifo::get_num_of_words(std::span<const uint8_t, 2> status) {
+    const uint16_t fifo_level = status[0] | ((status[1] & 0x01) << 8);
+
+    return std::min(fifo_level, max_words);
+}
+
+const std::array<float, 3>& ImuFifo::get_angular_displacement() const {
+    return this->angular_displacement;
+}
+
+const std::array<float, 3>& ImuFifo::get_linear_acceleration() const {
+    return this->linear_acceleration;
+}
+
+float ImuFifo::get_integration_time() const {
+    return this->integration_time;
+}
+
+float ImuFifo::get_temperature() const {
+    return this->temperature;
+}
+
+uint16_t ImuFifo::get_num_of_gyroscope_samples() const {
+    return this->num_of_gyroscope_samples;
+}
+
+uint16_t ImuFifo::get_num_of_accelerometer_samples() const {
+    return this->num_of_accelerometer_samples;
+}
+
+int16_t ImuFifo::get_value(std::span<const uint8_t, word_size> word, uint8_t index) {
+    return static_cast<int16_t>(word[1 + 2 * index] | (word[2 + 2 * index] << 8));
+}
+
+void ImuFifo::process_gyroscope(std::span<const uint8_t, word_size> word) {
+    std::array<float, 3> angular_velocity{};
+
+    for (uint8_t axis = 0; axis < 3; axis++) {
+        angular_velocity.at(axis) = get_value(word, axis) * this->gy_factor;
+    }
+
+    // The timestamp difference wraps around with the counter, so the integration is not affected by its overflow
+    if (this->has_gyroscope_sample) {
+        const float elapsed_time = (this->timestamp - this->last_gyroscope_timestamp) * timestamp_resolution;
+
+        for (uint8_t axis = 0; axis < 3; axis++) {
+            this->angular_displacement.at(axis) +=
+                (angular_velocity.at(axis) + this->last_angular_velocity.at(axis)) * elapsed_time / 2.0F;
+        }
+
+        this->integration_time += elapsed_time;
+    }
+
+    this->last_angular_velocity = angular_velocity;
+    this->last_gyroscope_timestamp = this->timestamp;
+    this->has_gyroscope_sample = true;
+    this->num_of_gyroscope_samples++;
+}
+
+void ImuFifo::process_accelerometer(std::span<const uint8_t, word_size> word) {
+    for (uint8_t axis = 0; axis < 3; axis++) {
+        this->linear_acceleration.at(axis) += get_value(word, axis) * this->xl_factor;
+    }
+
+    this->num_of_accelerometer_samples++;
+}
+}  // namespace micras::proxy
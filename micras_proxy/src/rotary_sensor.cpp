@@ -10,6 +10,10 @@
 namespace micras::proxy {
 RotarySensor::RotarySensor(const Config& config) :
     spi{config.spi}, encoder{config.encoder}, crc{config.crc}, resolution{config.resolution} {
+    if (config.edge_capture.has_value()) {
+        this->edge_capture.emplace(config.edge_capture.value());
+    }
+
     CommandFrame command_frame{};
     DataFrame    data_frame{};
 
@@ -43,7 +47,19 @@ RotarySensor::RotarySensor(const Config& config) :
 }
 
 float RotarySensor::get_position() const {
-    return encoder.get_counter() * 2.0F * std::numbers::pi_v<float> / this->resolution;
+    return encoder.get_counter() * this->get_position_step();
+}
+
+float RotarySensor::get_edge_age() const {
+    if (not this->edge_capture.has_value()) {
+        return 0.0F;
+    }
+
+    return this->edge_capture->get_capture_age();
+}
+
+float RotarySensor::get_position_step() const {
+    return 2.0F * std::numbers::pi_v<float> / this->resolution;
 }
 
 uint16_t RotarySensor::read_register(uint16_t address) {
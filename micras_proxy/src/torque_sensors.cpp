@@ -5,7 +5,6 @@
 #ifndef MICRAS_PROXY_TORQUE_SENSORS_CPP
 #define MICRAS_PROXY_TORQUE_SENSORS_CPP
 
-#include "micras/core/utils.hpp"
 #include "micras/proxy/torque_sensors.hpp"
 
 namespace micras::proxy {
@@ -14,27 +13,31 @@ TTorqueSensors<num_of_sensors>::TTorqueSensors(const Config& config) :
     adc{config.adc},
     max_current{hal::AdcDma::reference_voltage / config.shunt_resistor},
     max_torque{config.max_torque},
-    filters{core::make_array<core::ButterworthFilter, num_of_sensors>(config.filter_cutoff)} {
+    filters{config.filter} {
     this->adc.start_dma(this->buffer);
 }
 
 template <uint8_t num_of_sensors>
 void TTorqueSensors<num_of_sensors>::calibrate() {
     for (uint8_t i = 0; i < num_of_sensors; i++) {
-        this->base_reading[i] = this->filters[i].get_last();
+        this->base_reading[i] = this->filters.get_last(i);
     }
 }
 
 template <uint8_t num_of_sensors>
 void TTorqueSensors<num_of_sensors>::update() {
+    std::array<float, num_of_sensors> adc_readings{};
+
     for (uint8_t i = 0; i < num_of_sensors; i++) {
-        this->filters[i].update(this->get_adc_reading(i));
+        adc_readings[i] = this->get_adc_reading(i);
     }
+
+    this->filters.update(adc_readings);
 }
 
 template <uint8_t num_of_sensors>
 float TTorqueSensors<num_of_sensors>::get_torque(uint8_t sensor_index) const {
-    return this->filters.at(sensor_index).get_last() * this->max_torque;
+    return this->filters.get_last(sensor_index) * this->max_torque;
 }
 
 template <uint8_t num_of_sensors>
@@ -44,7 +47,7 @@ float TTorqueSensors<num_of_sensors>::get_torque_raw(uint8_t sensor_index) const
 
 template <uint8_t num_of_sensors>
 float TTorqueSensors<num_of_sensors>::get_current(uint8_t sensor_index) const {
-    return this->filters.at(sensor_index).get_last() * this->max_current;
+    return this->filters.get_last(sensor_index) * this->max_current;
 }
 
 template <uint8_t num_of_sensors>
@@ -5,6 +5,13 @@
 #ifndef MICRAS_PROXY_WALL_SENSORS_CPP
 #define MICRAS_PROXY_WALL_SENSORS_CPP
 
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <utility>
+
 #include "micras/core/utils.hpp"
 #include "micras/proxy/wall_sensors.hpp"
 
@@ -14,36 +21,73 @@ TWallSensors<num_of_sensors>::TWallSensors(const Config& config) :
     adc{config.adc},
     led_0_pwm{config.led_0_pwm},
     led_1_pwm{config.led_1_pwm},
-    filters{core::make_array<core::ButterworthFilter, num_of_sensors>(config.filter_cutoff)},
+    timer{config.timer},
+    oversampling{std::min(config.oversampling, max_oversampling)},
+    emitter_slots{config.emitter_slots},
+    num_of_slots{std::clamp<uint8_t>(config.num_of_slots, 1, max_num_of_slots)},
+    filters{core::make_array<core::SpeedAdaptiveFilter, num_of_sensors>(config.filter)},
     base_readings{config.base_readings},
+    base_distances{config.base_distances},
+    distance_tables{make_distance_tables(config.base_distances)},
     uncertainty{config.uncertainty} {
-    this->adc.start_dma(this->buffer);
+    this->distances.fill(std::numeric_limits<float>::infinity());
+    this->adc.set_transfer_callback(on_frame_completed, this);
+    this->adc.start_dma(std::span{this->buffer}.first(2 * this->oversampling * 2 * num_of_sensors));
     this->turn_off();
 }
 
 template <uint8_t num_of_sensors>
 void TWallSensors<num_of_sensors>::turn_on() {
-    this->led_0_pwm.set_duty_cycle(50.0F);
-    this->led_1_pwm.set_duty_cycle(50.0F);
+    // The DMA interrupt lights the next slot at the end of the current frame
+    this->emitting = true;
 }
 
 template <uint8_t num_of_sensors>
 void TWallSensors<num_of_sensors>::turn_off() {
+    this->emitting = false;
     this->led_0_pwm.set_duty_cycle(0.0F);
     this->led_1_pwm.set_duty_cycle(0.0F);
 }
 
 template <uint8_t num_of_sensors>
-void TWallSensors<num_of_sensors>::update() {
+void TWallSensors<num_of_sensors>::update(float linear_speed) {
+    uint32_t                          frame_number{};
+    uint32_t                          frame_timestamp{};
+    std::array<float, num_of_sensors> adc_readings{};
+
+    // A frame completed during the copy may have overwritten the copied half, so it is copied again
+    do {
+        frame_number = this->num_of_completed_frames;
+        frame_timestamp = this->completion_timestamp;
+        adc_readings = this->published_readings;
+        std::atomic_signal_fence(std::memory_order_acquire);
+    } while (frame_number != this->num_of_completed_frames);
+
+    // Without new frames, like while the emitters are off, the filters are not fed the same readings again
+    if (frame_number == this->frame_number) {
+        return;
+    }
+
+    // The filters follow the time between the frames, which is longer when the loop misses some of them
+    const float elapsed_time = (frame_timestamp - this->frame_timestamp) / 1e6F;
+
+    this->frame_number = frame_number;
+    this->frame_timestamp = frame_timestamp;
+    this->adc_readings = adc_readings;
+
     for (uint8_t i = 0; i < num_of_sensors; i++) {
-        this->filters[i].update(this->get_adc_reading(i));
+        const float reading = this->filters[i].update(this->adc_readings[i], linear_speed, elapsed_time);
+
+        this->distances[i] = reading > 0.0F ?
+                                 this->distance_tables[i].interpolate(this->normalize_reading(i, reading)) :
+                                 std::numeric_limits<float>::infinity();
     }
 }
 
 template <uint8_t num_of_sensors>
-bool TWallSensors<num_of_sensors>::get_wall(uint8_t sensor_index, bool disturbed) const {
-    return this->filters.at(sensor_index).get_last() >
-           this->base_readings.at(sensor_index) * this->uncertainty * (disturbed ? 1.2F : 1.0F);
+bool TWallSensors<num_of_sensors>::get_wall(uint8_t sensor_index) const {
+    // The reading threshold of the uncertainty is converted to a distance by the inverse square law
+    return this->distances.at(sensor_index) * std::sqrt(this->uncertainty) < this->base_distances.at(sensor_index);
 }
 
 template <uint8_t num_of_sensors>
@@ -53,9 +97,22 @@ float TWallSensors<num_of_sensors>::get_reading(uint8_t sensor_index) const {
 
 template <uint8_t num_of_sensors>
 float TWallSensors<num_of_sensors>::get_adc_reading(uint8_t sensor_index) const {
-    return static_cast<float>(std::abs(this->buffer.at(sensor_index) - this->buffer.at(sensor_index + num_of_sensors))
-           ) /
-           this->adc.get_max_reading();
+    return this->adc_readings.at(sensor_index);
+}
+
+template <uint8_t num_of_sensors>
+float TWallSensors<num_of_sensors>::get_lag() const {
+    return this->filters[0].get_lag();
+}
+
+template <uint8_t num_of_sensors>
+uint32_t TWallSensors<num_of_sensors>::get_frame_number() const {
+    return this->frame_number;
+}
+
+template <uint8_t num_of_sensors>
+uint32_t TWallSensors<num_of_sensors>::get_frame_timestamp() const {
+    return this->frame_timestamp;
 }
 
 template <uint8_t num_of_sensors>
@@ -63,10 +120,174 @@ float TWallSensors<num_of_sensors>::get_sensor_error(uint8_t sensor_index) const
     return this->get_reading(sensor_index) - this->base_readings.at(sensor_index);
 }
 
+template <uint8_t num_of_sensors>
+float TWallSensors<num_of_sensors>::get_distance(uint8_t sensor_index) const {
+    return this->distances.at(sensor_index);
+}
+
+template <uint8_t num_of_sensors>
+float TWallSensors<num_of_sensors>::get_distance_error(uint8_t sensor_index) const {
+    return this->get_distance(sensor_index) - this->base_distances.at(sensor_index);
+}
+
 template <uint8_t num_of_sensors>
 void TWallSensors<num_of_sensors>::calibrate_sensor(uint8_t sensor_index) {
     this->base_readings.at(sensor_index) = this->get_reading(sensor_index);
 }
+
+template <uint8_t num_of_sensors>
+bool TWallSensors<num_of_sensors>::calibrate_distance_table(
+    uint8_t sensor_index, std::span<const DistanceSample> samples
+) {
+    std::vector<typename DistanceTable::Sample> table_samples;
+    table_samples.reserve(samples.size());
+
+    for (const auto& sample : samples) {
+        if (sample.reading > 0.0F) {
+            table_samples.push_back({this->normalize_reading(sensor_index, sample.reading), sample.distance});
+        }
+    }
+
+    return this->distance_tables.at(sensor_index).fit(table_samples);
+}
+
+template <uint8_t num_of_sensors>
+std::vector<uint8_t> TWallSensors<num_of_sensors>::serialize() const {
+    std::vector<uint8_t> buffer;
+    buffer.reserve(num_of_sensors * (1 + distance_table_size) * sizeof(float));
+
+    for (const float base_reading : this->base_readings) {
+        const auto bytes = std::bit_cast<std::array<uint8_t, sizeof(float)>>(base_reading);
+        buffer.insert(buffer.end(), bytes.begin(), bytes.end());
+    }
+
+    for (const auto& table : this->distance_tables) {
+        for (const float value : table.get_values()) {
+            const auto bytes = std::bit_cast<std::array<uint8_t, sizeof(float)>>(value);
+            buffer.insert(buffer.end(), bytes.begin(), bytes.end());
+        }
+    }
+
+    return buffer;
+}
+
+template <uint8_t num_of_sensors>
+void TWallSensors<num_of_sensors>::deserialize(const uint8_t* buffer, uint16_t size) {
+    // Records saved with another size or without the base readings are discarded, keeping the uncalibrated tables
+    if (size != num_of_sensors * (1 + distance_table_size) * sizeof(float)) {
+        return;
+    }
+
+    const std::span<const uint8_t> data{buffer, size};
+
+    const auto read_value = [&data](uint16_t index) {
+        std::array<uint8_t, sizeof(float)> bytes{};
+        const auto                         value_data = data.subspan(index * sizeof(float), sizeof(float));
+
+        std::copy(value_data.begin(), value_data.end(), bytes.begin());
+        return std::bit_cast<float>(bytes);
+    };
+
+    std::array<float, num_of_sensors> base_readings{};
+
+    for (uint8_t i = 0; i < num_of_sensors; i++) {
+        base_readings.at(i) = read_value(i);
+
+        // NaN fails the comparison as well, so an erased record is discarded
+        if (not(base_readings.at(i) > 0.0F)) {
+            return;
+        }
+    }
+
+    this->base_readings = base_readings;
+
+    for (uint8_t i = 0; i < num_of_sensors; i++) {
+        std::array<float, distance_table_size> values{};
+
+        for (uint16_t j = 0; j < distance_table_size; j++) {
+            values.at(j) = read_value(num_of_sensors + i * distance_table_size + j);
+        }
+
+        this->distance_tables.at(i).set_values(values);
+    }
+}
+
+template <uint8_t num_of_sensors>
+float TWallSensors<num_of_sensors>::normalize_reading(uint8_t sensor_index, float reading) const {
+    return std::sqrt(this->base_readings.at(sensor_index) / reading);
+}
+
+template <uint8_t num_of_sensors>
+std::array<float, num_of_sensors> TWallSensors<num_of_sensors>::decimate_frame(uint8_t half) const {
+    const uint16_t                    frame_start = half * this->oversampling * 2 * num_of_sensors;
+    const float                       max_sum = this->oversampling * static_cast<float>(this->adc.get_max_reading());
+    std::array<float, num_of_sensors> adc_readings{};
+
+    for (uint8_t i = 0; i < num_of_sensors; i++) {
+        int32_t sum{};
+
+        for (uint8_t period = 0; period < this->oversampling; period++) {
+            const uint16_t period_start = frame_start + period * 2 * num_of_sensors;
+
+            sum += this->buffer.at(period_start + i) - this->buffer.at(period_start + num_of_sensors + i);
+        }
+
+        adc_readings.at(i) = static_cast<float>(std::max(sum, 0)) / max_sum;
+    }
+
+    return adc_readings;
+}
+
+template <uint8_t num_of_sensors>
+void TWallSensors<num_of_sensors>::set_slot_emitters(uint8_t slot) {
+    const EmitterSlot& emitter_slot = this->emitter_slots.at(slot);
+
+    this->led_0_pwm.set_duty_cycle(emitter_slot.led_0_duty_cycle);
+    this->led_1_pwm.set_duty_cycle(emitter_slot.led_1_duty_cycle);
+}
+
+template <uint8_t num_of_sensors>
+void TWallSensors<num_of_sensors>::on_frame_completed(void* context, uint8_t half) {
+    auto* wall_sensors = static_cast<TWallSensors*>(context);
+
+    if (not wall_sensors->emitting) {
+        wall_sensors->valid_frame = false;
+        return;
+    }
+
+    // The interrupt of the last conversion runs at the end of the last period, unless it was delayed to the next one
+    const bool late = wall_sensors->led_0_pwm.get_period_phase() < 0.5F;
+
+    if (wall_sensors->valid_frame) {
+        const EmitterSlot& emitter_slot = wall_sensors->emitter_slots.at(wall_sensors->frame_slot);
+        const auto         adc_readings = wall_sensors->decimate_frame(half);
+
+        for (uint8_t i = 0; i < num_of_sensors; i++) {
+            if (emitter_slot.sensors.at(i)) {
+                wall_sensors->published_readings.at(i) = adc_readings.at(i);
+            }
+        }
+
+        wall_sensors->completion_timestamp = wall_sensors->timer.get_counter_us();
+        std::atomic_signal_fence(std::memory_order_release);
+        wall_sensors->num_of_completed_frames++;
+    }
+
+    wall_sensors->frame_slot = (wall_sensors->frame_slot + 1) % wall_sensors->num_of_slots;
+    wall_sensors->set_slot_emitters(wall_sensors->frame_slot);
+    wall_sensors->valid_frame = not late;
+}
+
+template <uint8_t num_of_sensors>
+std::array<typename TWallSensors<num_of_sensors>::DistanceTable, num_of_sensors>
+    TWallSensors<num_of_sensors>::make_distance_tables(const std::array<float, num_of_sensors>& base_distances) {
+    return [&]<std::size_t... I>(std::index_sequence<I...>) -> std::array<DistanceTable, num_of_sensors> {
+        return {DistanceTable{
+            min_normalized_reading, max_normalized_reading,
+            [&](float normalized_reading) { return base_distances[I] * normalized_reading; }
+        }...};
+    }(std::make_index_sequence<num_of_sensors>());
+}
 }  // namespace micras::proxy
 
 #endif  // MICRAS_PROXY_WALL_SENSORS_CPP
@@ -2,6 +2,8 @@
  * @file
  */
 
+#include <cmath>
+#include <numbers>
 #include <tuple>
 
 #include "micras/micras.hpp"
@@ -28,6 +30,11 @@ Micras::Micras() :
     maze{maze_config},
     odometry{rotary_sensor_left, rotary_sensor_right, imu, odometry_config},
     speed_controller{speed_controller_config},
+    feed_forward_estimator{
+        feed_forward_estimator_config, speed_controller_config.left_feed_forward,
+        speed_controller_config.right_feed_forward
+    },
+    tracking_controller{tracking_controller_config},
     follow_wall{wall_sensors, odometry.get_state().pose, follow_wall_config},
     interface{argb, button, buzzer, dip_switch, led},
     action_pose{odometry.get_state().pose} {
@@ -38,6 +45,9 @@ Micras::Micras() :
     this->fsm.add_state(std::make_unique<RunState>(State::RUN, *this));
     this->fsm.add_state(std::make_unique<WaitState>(State::WAIT_FOR_RUN, *this, State::RUN));
     this->fsm.add_state(std::make_unique<WaitState>(State::WAIT_FOR_CALIBRATE, *this, State::CALIBRATE));
+
+    this->calibration_storage.sync("wall_sensors", *this->wall_sensors);
+    this->calibration_storage.sync("feed_forward", this->feed_forward_estimator);
 }
 
 void Micras::update() {
@@ -50,11 +60,14 @@ void Micras::update() {
 
     this->fan.update();
     this->imu->update();
-    this->wall_sensors->update();
+    this->odometry.update_gyro_bias(this->elapsed_time);
+    this->wall_sensors->update(this->odometry.get_state().velocity.linear);
 
     this->fsm.update();
 
-    while (loop_stopwatch.elapsed_time_us() < loop_time_us) { }
+    while (loop_stopwatch.elapsed_time_us() < loop_time_us) {
+        this->imu->process_transfers();
+    }
 }
 
 bool Micras::calibrate() {
@@ -68,6 +81,16 @@ bool Micras::calibrate() {
         case CalibrationType::FRONT_WALL:
             this->wall_sensors->calibrate_sensor(wall_sensors_index.left_front);
             this->wall_sensors->calibrate_sensor(wall_sensors_index.right_front);
+            this->left_front_samples.clear();
+            this->right_front_samples.clear();
+            this->calibration_type = CalibrationType::DISTANCE_TABLE;
+            return false;
+
+        case CalibrationType::DISTANCE_TABLE:
+            if (not this->sweep_distance_tables()) {
+                return false;
+            }
+
             this->calibration_type = CalibrationType::SIDE_WALLS;
             this->wall_sensors->turn_off();
             return true;
@@ -76,24 +99,35 @@ bool Micras::calibrate() {
     return false;
 }
 
+bool Micras::is_sweeping_distances() const {
+    return this->calibration_type == CalibrationType::DISTANCE_TABLE;
+}
+
 void Micras::prepare() {
     if (this->objective == core::Objective::EXPLORE) {
         this->grid_pose = this->maze.get_next_goal(this->grid_pose, false);
         this->action_queuer.recompute({});
         this->current_action = this->action_queuer.pop();
+    } else if (this->objective == core::Objective::RETURN) {
+        // The exploration stopped at the center of the goal, facing away from the way back
+        this->grid_pose = this->grid_pose.turned_back().front();
+        this->action_queuer.recompute_turn_back();
+        this->current_action = this->action_queuer.pop();
     } else {
         this->current_action = this->action_queuer.pop();
     }
 }
 
 bool Micras::run() {
-    this->odometry.update(this->elapsed_time);
+    this->odometry.update(this->elapsed_time, this->speed_controller.get_last_acceleration().linear);
 
     const micras::nav::State& state = this->odometry.get_state();
     core::Observation         observation{};
 
     if (this->current_action->finished(this->action_pose.get())) {
-        if (this->finished) {
+        const bool solving = (this->objective == core::Objective::SOLVE);
+
+        if (this->finished or (solving and this->action_queuer.empty())) {
             this->finished = false;
             this->locomotion.stop();
 
@@ -104,25 +138,21 @@ bool Micras::run() {
             return true;
         }
 
-        this->speed_controller.reset();
-        this->action_pose.reset_reference();
+        this->action_pose.continue_reference(this->current_action->get_residual_pose(this->action_pose.get()));
 
         if (not this->action_queuer.empty()) {
             this->current_action = this->action_queuer.pop();
         } else {
             const bool returning = (this->objective == core::Objective::RETURN);
-            const bool solving = (this->objective == core::Objective::SOLVE);
 
-            if (not solving) {
-                observation = this->follow_wall.get_observation();
-                this->maze.update_walls(this->grid_pose, observation);
-            }
+            observation = this->follow_wall.get_observation();
+            this->maze.update_walls(this->grid_pose, observation);
 
             micras::nav::GridPose next_goal{};
 
-            if (solving or this->maze.finished(this->grid_pose.position, returning)) {
+            if (this->maze.finished(this->grid_pose.position, returning)) {
                 this->finished = true;
-                next_goal = this->grid_pose.turned_back().front();
+                next_goal = this->grid_pose;
             } else {
                 next_goal = this->maze.get_next_goal(this->grid_pose, returning);
             }
@@ -137,20 +167,57 @@ bool Micras::run() {
         }
     }
 
-    this->desired_speeds = this->current_action->get_speeds(this->action_pose.get());
+    const nav::Pose pose = this->action_pose.get();
+
+    this->desired_speeds = this->tracking_controller.compute_speeds(
+        pose, this->current_action->get_reference_pose(pose), this->current_action->get_speeds(pose)
+    );
 
     if (this->current_action->allow_follow_wall()) {
-        this->desired_speeds.angular =
+        const float wall_correction =
             this->follow_wall.compute_angular_correction(this->elapsed_time, state.velocity.linear);
+
+        // The walls define the heading better than the odometry, which is only tracked where there are no walls
+        if (this->follow_wall.is_following_walls()) {
+            this->desired_speeds.angular = wall_correction;
+        }
     }
 
+    // The corrections below move the odometry pose, which the heading window must not take as a motion of the robot
+    const nav::Pose window_pose = this->follow_wall.get_window_pose();
+
+    if (this->current_action->allow_follow_wall() and this->follow_wall.has_new_estimate()) {
+        this->correct_corridor_pose();
+    }
+
+    // The posts and the front wall calibration point give the advance of the robot along straight actions
+    if (std::abs(this->action_pose.get().orientation) < std::numbers::pi_v<float> / 4.0F) {
+        const bool straight = this->current_action->allow_follow_wall();
+
+        if (straight and this->follow_wall.saw_post()) {
+            // The filters of the wall sensors see the post after a fixed distance, which the robot already travelled
+            this->correct_advance(
+                nav::CorrectionLog::Source::POST, this->follow_wall.get_post_lag() - post_detection_offset
+            );
+        } else if ((straight or this->current_action->get_id() == nav::ActionQueuer::ActionType::TURN_BACK) and
+                   this->follow_wall.reached_front_wall()) {
+            this->correct_advance(nav::CorrectionLog::Source::FRONT_WALL, cell_size / 2.0F);
+        }
+    }
+
+    this->follow_wall.continue_window(window_pose);
+
     std::tie(this->left_response, this->right_response) =
         this->speed_controller.compute_control_commands(state.velocity, desired_speeds, this->elapsed_time);
 
     std::tie(this->left_ff, this->right_ff) =
         this->speed_controller.compute_feed_forward_commands(desired_speeds, this->elapsed_time);
 
-    this->locomotion.set_wheel_command(this->left_ff + this->left_response, this->right_ff + this->right_response);
+    const float left_command = this->left_ff + this->left_response;
+    const float right_command = this->right_ff + this->right_response;
+
+    this->locomotion.set_wheel_command(left_command, right_command);
+    this->feed_forward_estimator.update(state.velocity, left_command, right_command, this->elapsed_time);
 
     return false;
 }
@@ -167,7 +234,13 @@ void Micras::init() {
     this->locomotion.enable();
     this->odometry.reset();
     this->imu->calibrate();
+    this->speed_controller.reset();
+    this->speed_controller.set_feed_forward(
+        this->feed_forward_estimator.get_left_feed_forward(), this->feed_forward_estimator.get_right_feed_forward()
+    );
+    this->feed_forward_estimator.reset();
     this->action_pose.reset_reference();
+    this->correction_log.clear();
 }
 
 void Micras::reset() {
@@ -175,6 +248,90 @@ void Micras::reset() {
     this->finished = false;
 }
 
+void Micras::correct_advance(nav::CorrectionLog::Source source, float cell_advance) {
+    const float measured_point = this->current_action->get_cell_edge() + cell_advance;
+    const float estimated_advance = this->action_pose.get().position.x;
+    const float advance = measured_point + cell_size * std::round((estimated_advance - measured_point) / cell_size);
+    const float error = advance - estimated_advance;
+
+    // The front wall is seen from the calibration point onwards, so it only tells the robot is not behind it
+    if (std::abs(error) > max_advance_correction or
+        (source == nav::CorrectionLog::Source::FRONT_WALL and error < 0.0F)) {
+        return;
+    }
+
+    // The action pose is relative to the odometry, so it follows the correction as weighted by the odometry
+    const core::Vector direction = this->action_pose.get_direction();
+    const core::Vector measured_position = this->action_pose.to_absolute({advance, 0.0F});
+
+    this->odometry.correct_position(
+        direction, direction.x * measured_position.x + direction.y * measured_position.y,
+        source == nav::CorrectionLog::Source::POST ? post_deviation : front_wall_deviation
+    );
+    this->correction_log.record({source, this->current_action->get_id(), advance, error});
+}
+
+void Micras::correct_corridor_pose() {
+    const nav::Pose    pose = this->odometry.get_state().pose;
+    const float        right_angle = std::numbers::pi_v<float> / 2.0F;
+    const float        corridor_orientation = right_angle * std::round(pose.orientation / right_angle);
+    const core::Vector left_direction{-std::sin(corridor_orientation), std::cos(corridor_orientation)};
+
+    // The return run starts where the exploration stopped, at the edge of a cell instead of the start offset
+    const float start_advance = (this->objective == core::Objective::RETURN) ? 0.0F : start_offset;
+    const float center_phase = left_direction.x * (cell_size / 2.0F - start_advance);
+    const float lateral_position = left_direction.x * pose.position.x + left_direction.y * pose.position.y;
+    const float corridor_center = center_phase + cell_size * std::round((lateral_position - center_phase) / cell_size);
+
+    const float heading = this->follow_wall.get_heading();
+
+    this->odometry.correct_position(
+        left_direction, corridor_center + this->follow_wall.get_lateral_offset(), wall_lateral_deviation
+    );
+    this->odometry.correct_orientation(corridor_orientation + heading, wall_heading_deviation);
+}
+
+bool Micras::sweep_distance_tables() {
+    this->odometry.update(this->elapsed_time, this->speed_controller.get_last_acceleration().linear);
+
+    const micras::nav::State& state = this->odometry.get_state();
+    const float               travelled = -state.pose.position.x;
+
+    if (travelled >= this->left_front_samples.size() * distance_sweep_step) {
+        // The filtered readings were measured a few millimeters before, when the robot was closer to the wall
+        const float measured_travelled = travelled - this->wall_sensors->get_lag();
+
+        this->left_front_samples.push_back(
+            {this->wall_sensors->get_reading(wall_sensors_index.left_front),
+             wall_sensors_config.base_distances.at(wall_sensors_index.left_front) + measured_travelled}
+        );
+        this->right_front_samples.push_back(
+            {this->wall_sensors->get_reading(wall_sensors_index.right_front),
+             wall_sensors_config.base_distances.at(wall_sensors_index.right_front) + measured_travelled}
+        );
+    }
+
+    if (travelled >= distance_sweep_length) {
+        this->locomotion.stop();
+        this->wall_sensors->calibrate_distance_table(wall_sensors_index.left_front, this->left_front_samples);
+        this->wall_sensors->calibrate_distance_table(wall_sensors_index.right_front, this->right_front_samples);
+        this->save_calibration();
+        return true;
+    }
+
+    const nav::Twist desired_speeds{-distance_sweep_speed, 0.0F};
+
+    std::tie(this->left_response, this->right_response) =
+        this->speed_controller.compute_control_commands(state.velocity, desired_speeds, this->elapsed_time);
+
+    std::tie(this->left_ff, this->right_ff) =
+        this->speed_controller.compute_feed_forward_commands(desired_speeds, this->elapsed_time);
+
+    this->locomotion.set_wheel_command(this->left_ff + this->left_response, this->right_ff + this->right_response);
+
+    return false;
+}
+
 bool Micras::check_crash() const {
     return std::hypot(
                this->imu->get_linear_acceleration(proxy::Imu::Axis::X),
@@ -192,6 +349,10 @@ void Micras::load_best_route() {
     this->action_queuer.recompute(this->maze.get_best_route());
 }
 
+void Micras::save_calibration() {
+    this->calibration_storage.save();
+}
+
 core::Objective Micras::get_objective() const {
     return this->objective;
 }
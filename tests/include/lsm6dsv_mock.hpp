@@ -0,0 +1,186 @@
+/**
+ * @file
+ */
+
+#ifndef MICRAS_LSM6DSV_MOCK_HPP
+#define MICRAS_LSM6DSV_MOCK_HPP
+
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <lsm6dsv_reg.h>
+#include <span>
+
+namespace micras {
+/**
+ * @brief Register level mock of the LSM6DSV, to test the IMU drivers without the device.
+ *
+ * @details The registers are kept in memory and the FIFO words pushed by the test are read through the FIFO status
+ * and output registers, with the address rolling back to the tag after each word like in the device.
+ */
+class Lsm6dsvMock {
+public:
+    /**
+     * @brief Sensor tags of the FIFO words.
+     */
+    enum Tag : uint8_t {
+        GYROSCOPE = 0x01,
+        ACCELEROMETER = 0x02,
+        TEMPERATURE = 0x03,
+        TIMESTAMP = 0x04,
+    };
+
+    /**
+     * @brief Construct a new Lsm6dsvMock object.
+     */
+    Lsm6dsvMock() {
+        this->dev_ctx.read_reg = read;
+        this->dev_ctx.write_reg = write;
+        this->dev_ctx.handle = this;
+    }
+
+    /**
+     * @brief Get the device context to be used by the IMU library.
+     *
+     * @return Device context reading and writing the mock registers.
+     */
+    stmdev_ctx_t& get_context() { return this->dev_ctx; }
+
+    /**
+     * @brief Push a sample with three 16 bits values to the FIFO.
+     *
+     * @param tag Sensor tag of the sample.
+     * @param values Raw values of the sample.
+     */
+    void push(Tag tag, const std::array<int16_t, 3>& values) {
+        std::array<uint8_t, word_size> word{static_cast<uint8_t>(tag << 3)};
+
+        for (uint8_t i = 0; i < 3; i++) {
+            word.at(1 + 2 * i) = static_cast<uint8_t>(values.at(i) & 0xFF);
+            word.at(2 + 2 * i) = static_cast<uint8_t>((values.at(i) >> 8) & 0xFF);
+        }
+
+        this->fifo.push_back(word);
+    }
+
+    /**
+     * @brief Push a timestamp to the FIFO.
+     *
+     * @param timestamp Raw timestamp.
+     */
+    void push_timestamp(uint32_t timestamp) {
+        this->fifo.push_back(
+            {static_cast<uint8_t>(Tag::TIMESTAMP << 3), static_cast<uint8_t>(timestamp & 0xFF),
+             static_cast<uint8_t>((timestamp >> 8) & 0xFF), static_cast<uint8_t>((timestamp >> 16) & 0xFF),
+             static_cast<uint8_t>((timestamp >> 24) & 0xFF)}
+        );
+    }
+
+    /**
+     * @brief Get a register value written by the library.
+     *
+     * @param reg Register address.
+     * @return Register value.
+     */
+    uint8_t get_register(uint8_t reg) const { return this->registers.at(reg); }
+
+    /**
+     * @brief Get the number of read transactions since the construction.
+     *
+     * @return Number of read transactions.
+     */
+    uint32_t get_num_of_reads() const { return this->num_of_reads; }
+
+    /**
+     * @brief Get the number of words still in the FIFO.
+     *
+     * @return Number of words.
+     */
+    uint16_t get_fifo_level() const { return static_cast<uint16_t>(this->fifo.size()); }
+
+private:
+    /**
+     * @brief Read registers of the mock.
+     *
+     * @param handle Pointer to the mock.
+     * @param reg First register to read.
+     * @param bufp Buffer to read.
+     * @param len Length of the buffer.
+     * @return 0 if the operation was successful.
+     */
+    static int32_t read(void* handle, uint8_t reg, uint8_t* bufp, uint16_t len) {
+        auto*                    mock = static_cast<Lsm6dsvMock*>(handle);
+        const std::span<uint8_t> data{bufp, len};
+
+        mock->num_of_reads++;
+
+        if (reg == LSM6DSV_FIFO_DATA_OUT_TAG) {
+            for (uint16_t i = 0; i < len; i++) {
+                data[i] = mock->fifo.empty() ? 0 : mock->fifo.front().at(i % word_size);
+
+                if (i % word_size == word_size - 1 and not mock->fifo.empty()) {
+                    mock->fifo.pop_front();
+                }
+            }
+
+            return 0;
+        }
+
+        mock->registers.at(LSM6DSV_FIFO_STATUS1) = static_cast<uint8_t>(mock->fifo.size() & 0xFF);
+        mock->registers.at(LSM6DSV_FIFO_STATUS1 + 1) = static_cast<uint8_t>((mock->fifo.size() >> 8) & 0x01);
+
+        for (uint16_t i = 0; i < len; i++) {
+            data[i] = mock->registers.at(reg + i);
+        }
+
+        return 0;
+    }
+
+    /**
+     * @brief Write registers of the mock.
+     *
+     * @param handle Pointer to the mock.
+     * @param reg First register to write.
+     * @param bufp Buffer to write.
+     * @param len Length of the buffer.
+     * @return 0 if the operation was successful.
+     */
+    static int32_t write(void* handle, uint8_t reg, const uint8_t* bufp, uint16_t len) {
+        auto*                          mock = static_cast<Lsm6dsvMock*>(handle);
+        const std::span<const uint8_t> data{bufp, len};
+
+        for (uint16_t i = 0; i < len; i++) {
+            mock->registers.at(reg + i) = data[i];
+        }
+
+        return 0;
+    }
+
+    /**
+     * @brief Size of a FIFO word, with the tag byte and six data bytes.
+     */
+    static constexpr uint8_t word_size{7};
+
+    /**
+     * @brief Device context for the IMU library.
+     */
+    stmdev_ctx_t dev_ctx{};
+
+    /**
+     * @brief Register values.
+     */
+    std::array<uint8_t, 0x80> registers{};
+
+    /**
+     * @brief Words stored in the FIFO.
+     */
+    std::deque<std::array<uint8_t, word_size>> fifo;
+
+    /**
+     * @brief Number of read transactions.
+     */
+    uint32_t num_of_reads{};
+};
+}  // namespace micras
+
+#endif  // MICRAS_LSM6DSV_MOCK_HPP
@@ -0,0 +1,141 @@
+/**
+ * @file
+ */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numbers>
+#include <random>
+
+#include "test_core.hpp"
+
+using namespace micras;  // NOLINT(google-build-using-namespace)
+
+static constexpr float    sampling_frequency{1000.0F};
+static constexpr float    cutoff_frequency{20.0F};
+static constexpr uint8_t  num_of_channels{4};
+static constexpr uint16_t num_of_response_samples{4000};
+static constexpr uint32_t num_of_benchmark_samples{20000};
+static constexpr float    max_gain_error{0.01F};
+static constexpr float    max_stopband_gain{0.001F};
+static constexpr float    max_difference{0.0001F};
+
+// The design of the coefficients must be possible at compile time
+static constexpr auto low_pass_coefficients = core::TBiquadFilterBank<num_of_channels, 4>::design_butterworth(
+    {core::FilterDesign::LOW_PASS, cutoff_frequency, sampling_frequency}
+);
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+static volatile float    test_cutoff_gain{};
+static volatile float    test_odd_cutoff_gain{};
+static volatile float    test_stopband_gain{};
+static volatile float    test_high_pass_dc_gain{};
+static volatile float    test_high_pass_gain{};
+static volatile float    test_max_difference{};
+static volatile uint32_t test_bank_time_us{};
+static volatile uint32_t test_objects_time_us{};
+static volatile float    test_checksum{};
+
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+/**
+ * @brief Measure the gain of a filter bank to a sine wave, fed to all its channels.
+ *
+ * @tparam B Type of the filter bank.
+ * @param bank Filter bank.
+ * @param frequency Frequency of the sine wave in Hz.
+ * @return Amplitude of the filtered wave after the transient from its mean square, relative to the input one.
+ */
+template <typename B>
+static float measure_gain(B bank, float frequency) {
+    float square_sum{};
+
+    for (uint16_t i = 0; i < num_of_response_samples; i++) {
+        std::array<float, num_of_channels> inputs{};
+        inputs.fill(std::sin(2.0F * std::numbers::pi_v<float> * frequency * i / sampling_frequency));
+
+        const auto& outputs = bank.update(inputs);
+
+        if (i >= num_of_response_samples / 2) {
+            square_sum += outputs[0] * outputs[0];
+        }
+    }
+
+    return std::sqrt(4.0F * square_sum / num_of_response_samples);
+}
+
+int main(int argc, char* argv[]) {
+    TestCore::init(argc, argv);
+    proxy::Argb      argb{argb_config};
+    proxy::Stopwatch stopwatch{stopwatch_config};
+
+    const core::TBiquadFilterBank<num_of_channels, 4> low_pass{low_pass_coefficients};
+    const core::TBiquadFilterBank<num_of_channels, 3> odd_low_pass{
+        core::FilterDesign{core::FilterDesign::LOW_PASS, cutoff_frequency, sampling_frequency}
+    };
+    const core::TBiquadFilterBank<num_of_channels, 2> high_pass{
+        core::FilterDesign{core::FilterDesign::HIGH_PASS, cutoff_frequency, sampling_frequency}
+    };
+
+    test_cutoff_gain = measure_gain(low_pass, cutoff_frequency);
+    test_odd_cutoff_gain = measure_gain(odd_low_pass, cutoff_frequency);
+    test_stopband_gain = measure_gain(low_pass, 10.0F * cutoff_frequency);
+    test_high_pass_dc_gain = measure_gain(high_pass, 0.1F);
+    test_high_pass_gain = measure_gain(high_pass, 10.0F * cutoff_frequency);
+
+    // The second order filters match the Butterworth filter objects, which take the cutoff in rad/s at 100 Hz
+    core::TBiquadFilterBank<num_of_channels> bank{core::FilterDesign{
+        core::FilterDesign::LOW_PASS, cutoff_frequency / (2.0F * std::numbers::pi_v<float>), sampling_frequency
+    }};
+    auto filters =
+        core::make_array<core::ButterworthFilter, num_of_channels>(cutoff_frequency * 100.0F / sampling_frequency);
+
+    std::minstd_rand                      generator{1};
+    std::uniform_real_distribution<float> noise{-1.0F, 1.0F};
+    std::array<float, num_of_channels>    inputs{};
+    float                                 difference{};
+    float                                 checksum{};
+
+    for (uint16_t i = 0; i < num_of_response_samples; i++) {
+        std::generate(inputs.begin(), inputs.end(), [&]() { return noise(generator); });
+        bank.update(inputs);
+
+        for (uint8_t j = 0; j < num_of_channels; j++) {
+            difference = std::max(difference, std::abs(filters.at(j).update(inputs.at(j)) - bank.get_last(j)));
+        }
+    }
+
+    test_max_difference = difference;
+
+    stopwatch.reset_us();
+
+    for (uint32_t i = 0; i < num_of_benchmark_samples; i++) {
+        inputs.fill(static_cast<float>(i & 1U));
+        checksum += bank.update(inputs)[0];
+    }
+
+    test_bank_time_us = stopwatch.elapsed_time_us();
+    stopwatch.reset_us();
+
+    for (uint32_t i = 0; i < num_of_benchmark_samples; i++) {
+        for (auto& filter : filters) {
+            checksum -= filter.update(static_cast<float>(i & 1U));
+        }
+    }
+
+    test_objects_time_us = stopwatch.elapsed_time_us();
+    test_checksum = checksum;
+
+    const bool passed = std::abs(test_cutoff_gain - std::numbers::sqrt2_v<float> / 2.0F) <= max_gain_error and
+                        std::abs(test_odd_cutoff_gain - std::numbers::sqrt2_v<float> / 2.0F) <= max_gain_error and
+                        test_stopband_gain <= max_stopband_gain and test_high_pass_dc_gain <= max_gain_error and
+                        std::abs(test_high_pass_gain - 1.0F) <= max_gain_error and
+                        test_max_difference <= max_difference;
+
+    argb.set_color(passed ? proxy::Argb::Colors::green : proxy::Argb::Colors::red);
+
+    TestCore::loop([]() { });
+
+    return 0;
+}
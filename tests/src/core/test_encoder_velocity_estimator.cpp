@@ -0,0 +1,106 @@
+/**
+ * @file
+ */
+
+#include <cmath>
+#include <numbers>
+
+#include "constants.hpp"
+#include "test_core.hpp"
+
+using namespace micras;  // NOLINT(google-build-using-namespace)
+
+static constexpr float    sample_time{loop_time_us / 1e6F};
+static constexpr float    capture_period{5e-6F};
+static constexpr uint16_t captures_per_sample{static_cast<uint16_t>(loop_time_us / 5)};
+static constexpr uint16_t num_of_samples{2000};
+static constexpr uint16_t num_of_stop_samples{200};
+static constexpr float    step{2.0F * std::numbers::pi_v<float> / 4096.0F};
+static constexpr float    mean_velocity{3.0F};
+static constexpr float    velocity_amplitude{2.5F};
+static constexpr float    max_error_ratio{0.2F};
+static constexpr float    max_stop_velocity{0.05F};
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+static volatile float test_difference_error{};
+static volatile float test_loop_timed_error{};
+static volatile float test_captured_error{};
+static volatile float test_stop_velocity{};
+
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+/**
+ * @brief Get the velocity of the wheel at a time of the synthetic run, slow like during a launch or a turn back.
+ *
+ * @param time Time since the start of the run in seconds.
+ * @return The wheel velocity in rad/s.
+ */
+static float wheel_velocity(float time) {
+    if (time >= num_of_samples * sample_time) {
+        return 0.0F;
+    }
+
+    return mean_velocity + velocity_amplitude * std::sin(2.0F * std::numbers::pi_v<float> * time);
+}
+
+int main(int argc, char* argv[]) {
+    TestCore::init(argc, argv);
+    proxy::Argb argb{argb_config};
+
+    core::EncoderVelocityEstimator captured_estimator{odometry_config.wheel_velocity, step};
+    core::EncoderVelocityEstimator loop_timed_estimator{odometry_config.wheel_velocity, step};
+
+    float    position{};
+    int32_t  count{};
+    int32_t  last_count{};
+    float    time{};
+    float    edge_time{};
+    float    difference_error_sum{};
+    float    loop_timed_error_sum{};
+    float    captured_error_sum{};
+    uint16_t num_of_errors{};
+
+    for (uint16_t i = 0; i < num_of_samples + num_of_stop_samples; i++) {
+        // The wheel is simulated between the samples at the resolution of the capture timer
+        for (uint16_t j = 0; j < captures_per_sample; j++) {
+            time += capture_period;
+            position += wheel_velocity(time) * capture_period;
+
+            const auto new_count = static_cast<int32_t>(std::floor(position / step));
+
+            if (new_count != count) {
+                count = new_count;
+                edge_time = time;
+            }
+        }
+
+        const float displacement = (count - last_count) * step;
+        last_count = count;
+
+        const float captured_velocity = captured_estimator.update(displacement, time - edge_time, sample_time);
+        const float loop_timed_velocity = loop_timed_estimator.update(displacement, 0.0F, sample_time);
+        const float velocity = wheel_velocity(time);
+
+        // The start is skipped, since no estimator knows the velocity before the first edges
+        if (i > 100 and i < num_of_samples) {
+            difference_error_sum += std::pow(displacement / sample_time - velocity, 2.0F);
+            loop_timed_error_sum += std::pow(loop_timed_velocity - velocity, 2.0F);
+            captured_error_sum += std::pow(captured_velocity - velocity, 2.0F);
+            num_of_errors++;
+        }
+    }
+
+    test_difference_error = std::sqrt(difference_error_sum / num_of_errors);
+    test_loop_timed_error = std::sqrt(loop_timed_error_sum / num_of_errors);
+    test_captured_error = std::sqrt(captured_error_sum / num_of_errors);
+    test_stop_velocity = std::abs(captured_estimator.get_last());
+
+    const bool passed = test_captured_error <= max_error_ratio * test_difference_error and
+                        test_loop_timed_error < test_difference_error and test_stop_velocity <= max_stop_velocity;
+
+    argb.set_color(passed ? proxy::Argb::Colors::green : proxy::Argb::Colors::red);
+
+    TestCore::loop([]() { });
+
+    return 0;
+}
@@ -0,0 +1,135 @@
+/**
+ * @file
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+#include "micras/core/fastmath.hpp"
+#include "test_core.hpp"
+
+using namespace micras;  // NOLINT(google-build-using-namespace)
+
+static constexpr uint32_t num_of_samples{100000};
+static constexpr float    max_angle{100.0F};
+static constexpr float    max_sincos_error{2e-7F};
+static constexpr float    max_atan2_error{3e-6F};
+static constexpr float    max_hypot_error{2e-7F};
+static constexpr float    max_rsqrt_error{5e-6F};
+static constexpr float    max_wrap_angle_error{2e-7F};
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+static volatile float    test_sincos_error{};
+static volatile float    test_atan2_error{};
+static volatile float    test_hypot_error{};
+static volatile float    test_rsqrt_error{};
+static volatile float    test_wrap_angle_error{};
+static volatile uint32_t test_std_time_us{};
+static volatile uint32_t test_fast_time_us{};
+static volatile float    test_checksum{};
+
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+/**
+ * @brief Get a sample of a sweep over a range.
+ *
+ * @param index Index of the sample.
+ * @param min Start of the range.
+ * @param max End of the range.
+ * @return Value of the sample.
+ */
+static float sweep(uint32_t index, float min, float max) {
+    return min + (max - min) * static_cast<float>(index) / (num_of_samples - 1);
+}
+
+/**
+ * @brief Run the functions of a control loop tick over the samples and measure its time.
+ *
+ * @tparam F Type of the function of a tick.
+ * @param stopwatch Stopwatch to measure the time.
+ * @param tick Function of a tick, returning a value to keep its result.
+ * @return Time taken by all the samples in microseconds.
+ */
+template <typename F>
+static uint32_t measure_time(proxy::Stopwatch& stopwatch, F tick) {
+    float checksum{};
+
+    stopwatch.reset_us();
+
+    for (uint32_t i = 0; i < num_of_samples; i++) {
+        checksum += tick(sweep(i, -max_angle, max_angle), sweep(i, -1.0F, 2.0F));
+    }
+
+    const uint32_t time = stopwatch.elapsed_time_us();
+    test_checksum = test_checksum + checksum;
+
+    return time;
+}
+
+int main(int argc, char* argv[]) {
+    TestCore::init(argc, argv);
+    proxy::Argb      argb{argb_config};
+    proxy::Stopwatch stopwatch{stopwatch_config};
+
+    double sincos_error{};
+    double atan2_error{};
+    double hypot_error{};
+    double rsqrt_error{};
+    double wrap_angle_error{};
+
+    for (uint32_t i = 0; i < num_of_samples; i++) {
+        const float angle = sweep(i, -max_angle, max_angle);
+        const auto [sin, cos] = core::fastmath::sincos(angle);
+        const float wrapped_angle = core::fastmath::wrap_angle(angle);
+
+        sincos_error = std::max(
+            {sincos_error, std::abs(sin - std::sin(static_cast<double>(angle))),
+             std::abs(cos - std::cos(static_cast<double>(angle)))}
+        );
+        wrap_angle_error = std::max(
+            wrap_angle_error,
+            std::abs(std::remainder(static_cast<double>(angle), 2.0 * std::numbers::pi) - wrapped_angle)
+        );
+
+        // The points go around a circle, with a radius changing by orders of magnitude
+        const float radius = std::pow(10.0F, sweep(i, -3.0F, 3.0F));
+        const float x = radius * std::cos(angle);
+        const float y = radius * std::sin(angle);
+
+        const double atan2_difference = core::fastmath::atan2(y, x) - std::atan2(static_cast<double>(y), x);
+        const double hypot_ratio = core::fastmath::hypot(x, y) / std::hypot(static_cast<double>(x), y);
+        const double rsqrt_ratio = core::fastmath::rsqrt(radius) * std::sqrt(static_cast<double>(radius));
+
+        atan2_error = std::max(atan2_error, std::abs(std::remainder(atan2_difference, 2.0 * std::numbers::pi)));
+        hypot_error = std::max(hypot_error, std::abs(hypot_ratio - 1.0));
+        rsqrt_error = std::max(rsqrt_error, std::abs(rsqrt_ratio - 1.0));
+    }
+
+    test_sincos_error = static_cast<float>(sincos_error);
+    test_atan2_error = static_cast<float>(atan2_error);
+    test_hypot_error = static_cast<float>(hypot_error);
+    test_rsqrt_error = static_cast<float>(rsqrt_error);
+    test_wrap_angle_error = static_cast<float>(wrap_angle_error);
+
+    // Each tick integrates the odometry, wraps the orientation and finds the distance and the angle to a point
+    test_std_time_us = measure_time(stopwatch, [](float angle, float value) {
+        const float wrapped_angle = std::remainder(angle, 2.0F * std::numbers::pi_v<float>);
+        return std::sin(angle) + std::cos(angle) + wrapped_angle + std::hypot(value, angle) + std::atan2(value, angle);
+    });
+    test_fast_time_us = measure_time(stopwatch, [](float angle, float value) {
+        const auto [sin, cos] = core::fastmath::sincos(angle);
+        return sin + cos + core::fastmath::wrap_angle(angle) + core::fastmath::hypot(value, angle) +
+               core::fastmath::atan2(value, angle);
+    });
+
+    const bool passed = test_sincos_error <= max_sincos_error and test_atan2_error <= max_atan2_error and
+                        test_hypot_error <= max_hypot_error and test_rsqrt_error <= max_rsqrt_error and
+                        test_wrap_angle_error <= max_wrap_angle_error;
+
+    argb.set_color(passed ? proxy::Argb::Colors::green : proxy::Argb::Colors::red);
+
+    TestCore::loop([]() { });
+
+    return 0;
+}
@@ -0,0 +1,94 @@
+/**
+ * @file
+ */
+
+#include <cmath>
+#include <random>
+
+#include "constants.hpp"
+#include "micras/core/gyro_bias_estimator.hpp"
+#include "test_core.hpp"
+
+using namespace micras;  // NOLINT(google-build-using-namespace)
+
+static constexpr float sample_time{loop_time_us / 1e6F};
+static constexpr float run_duration{600.0F};
+static constexpr float cycle_duration{9.0F};
+static constexpr float stop_duration{1.0F};
+static constexpr float initial_bias{0.01F};
+static constexpr float temperature_coefficient{0.0004F};
+static constexpr float temperature_rise{15.0F};
+static constexpr float heating_time_constant{200.0F};
+static constexpr float max_heading_error{0.1F};
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+static volatile float test_fixed_heading_error{};
+static volatile float test_estimated_heading_error{};
+static volatile float test_final_bias_error{};
+
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+int main(int argc, char* argv[]) {
+    TestCore::init(argc, argv);
+    proxy::Argb             argb{argb_config};
+    core::GyroBiasEstimator estimator{odometry_config.gyro_bias};
+
+    std::mt19937                    generator{42};
+    std::normal_distribution<float> gyro_noise{0.0F, odometry_config.gyro_bias.gyro_noise};
+    std::normal_distribution<float> moving_acceleration{0.0F, 1.0F};
+    std::normal_distribution<float> still_acceleration{0.0F, 0.02F};
+
+    float wheel_position{};
+    float fixed_bias{};
+    float fixed_heading_error{};
+    float estimated_heading_error{};
+    float true_bias{};
+    float estimated_bias{};
+
+    // The robot waits still while the bias is calibrated, then runs and stops for a moment every cycle
+    for (float time = 0.0F; time < run_duration; time += sample_time) {
+        const float heating = temperature_rise * (1.0F - std::exp(-time / heating_time_constant));
+        const float temperature = odometry_config.gyro_bias.reference_temperature + heating;
+        const bool  moving = time > stop_duration and std::fmod(time, cycle_duration) > stop_duration;
+
+        true_bias = initial_bias + temperature_coefficient * heating;
+
+        if (moving) {
+            wheel_position += 40.0F * sample_time;
+        }
+
+        estimator.update(
+            {
+                .angular_velocity = true_bias + gyro_noise(generator),
+                .linear_acceleration_x = moving ? moving_acceleration(generator) : still_acceleration(generator),
+                .linear_acceleration_y = moving ? moving_acceleration(generator) : still_acceleration(generator),
+                .temperature = temperature,
+                .left_wheel_position = wheel_position,
+                .right_wheel_position = wheel_position,
+            },
+            sample_time
+        );
+
+        estimated_bias = estimator.get_bias(temperature);
+
+        if (time < stop_duration) {
+            fixed_bias = estimated_bias;
+        }
+
+        fixed_heading_error += (true_bias - fixed_bias) * sample_time;
+        estimated_heading_error += (true_bias - estimated_bias) * sample_time;
+    }
+
+    test_fixed_heading_error = std::abs(fixed_heading_error);
+    test_estimated_heading_error = std::abs(estimated_heading_error);
+    test_final_bias_error = std::abs(true_bias - estimated_bias);
+
+    const bool passed = test_estimated_heading_error <= max_heading_error and
+                        test_fixed_heading_error >= 10.0F * test_estimated_heading_error;
+
+    argb.set_color(passed ? proxy::Argb::Colors::green : proxy::Argb::Colors::red);
+
+    TestCore::loop([]() { });
+
+    return 0;
+}
@@ -0,0 +1,87 @@
+/**
+ * @file
+ */
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "test_core.hpp"
+
+using namespace micras;  // NOLINT(google-build-using-namespace)
+
+static constexpr uint16_t table_size{proxy::WallSensors::distance_table_size};
+static constexpr float    base_distance{0.0837F};
+static constexpr float    emitter_offset{0.015F};
+static constexpr float    reading_noise{0.01F};
+static constexpr float    min_sweep_distance{0.03F};
+static constexpr float    max_sweep_distance{0.25F};
+static constexpr uint16_t num_of_sweep_samples{500};
+static constexpr uint16_t num_of_checks{100};
+static constexpr float    max_fitted_error{0.001F};
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+static volatile float test_model_error{};
+static volatile float test_fitted_error{};
+static volatile bool  test_fitted{};
+static volatile bool  test_rejected{};
+
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+/**
+ * @brief Get the reading of a synthetic sensor, whose light spreads from behind the sensor instead of from it.
+ *
+ * @param distance Distance to the wall in meters.
+ * @return Reading relative to the reading at the base distance.
+ */
+static float sensor_reading(float distance) {
+    return std::pow((base_distance + emitter_offset) / (distance + emitter_offset), 2.0F);
+}
+
+int main(int argc, char* argv[]) {
+    TestCore::init(argc, argv);
+    proxy::Argb argb{argb_config};
+
+    // The tables take the square root of the ratio between the base reading and the reading, like the wall sensors
+    core::TLookupTable<table_size> table{0.25F, 4.0F, [](float input) { return base_distance * input; }};
+    std::minstd_rand                generator{1};
+    std::normal_distribution<float> noise{1.0F, reading_noise};
+
+    std::vector<core::TLookupTable<table_size>::Sample> samples;
+
+    for (uint16_t i = 0; i < num_of_sweep_samples; i++) {
+        const float distance =
+            min_sweep_distance + (max_sweep_distance - min_sweep_distance) * i / (num_of_sweep_samples - 1);
+
+        samples.push_back({std::sqrt(1.0F / (sensor_reading(distance) * noise(generator))), distance});
+    }
+
+    // A sweep out of the range of the table must keep it
+    const std::vector<core::TLookupTable<table_size>::Sample> far_samples{{10.0F, 1.0F}, {20.0F, 2.0F}};
+
+    test_rejected = not table.fit(far_samples);
+    test_fitted = table.fit(samples);
+
+    float model_error_sum{};
+    float fitted_error_sum{};
+
+    for (uint16_t i = 0; i < num_of_checks; i++) {
+        const float distance = min_sweep_distance + (max_sweep_distance - min_sweep_distance) * i / (num_of_checks - 1);
+        const float input = std::sqrt(1.0F / sensor_reading(distance));
+
+        model_error_sum += std::pow(base_distance * input - distance, 2.0F);
+        fitted_error_sum += std::pow(table.interpolate(input) - distance, 2.0F);
+    }
+
+    test_model_error = std::sqrt(model_error_sum / num_of_checks);
+    test_fitted_error = std::sqrt(fitted_error_sum / num_of_checks);
+
+    const bool passed = test_rejected and test_fitted and test_fitted_error <= max_fitted_error and
+                        test_fitted_error < test_model_error;
+
+    argb.set_color(passed ? proxy::Argb::Colors::green : proxy::Argb::Colors::red);
+
+    TestCore::loop([]() { });
+
+    return 0;
+}
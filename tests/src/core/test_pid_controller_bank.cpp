@@ -0,0 +1,138 @@
+/**
+ * @file
+ */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+
+#include "micras/core/pid_controller.hpp"
+#include "micras/core/pid_controller_bank.hpp"
+#include "test_core.hpp"
+
+using namespace micras;  // NOLINT(google-build-using-namespace)
+
+static constexpr float    sample_time{0.001F};
+static constexpr float    plant_time_constant{0.05F};
+static constexpr float    saturation{1.2F};
+static constexpr float    measure_noise{0.01F};
+static constexpr uint16_t num_of_response_samples{2000};
+static constexpr uint32_t num_of_benchmark_samples{20000};
+static constexpr float    max_overshoot{0.02F};
+
+// Windup without and with back-calculation, then a derivative without and with its filter
+static constexpr uint8_t num_of_controllers{4};
+
+static const std::array<core::TPidControllerBank<num_of_controllers>::Config, num_of_controllers> configs{{
+    {.kp = 2.0F, .ki = 20.0F, .saturation = saturation},
+    {.kp = 2.0F, .ki = 20.0F, .tracking_gain = 20.0F, .saturation = saturation},
+    {.kp = 2.0F, .ki = 20.0F, .kd = 0.01F},
+    {.kp = 2.0F, .ki = 20.0F, .kd = 0.01F, .derivative_cutoff = 20.0F},
+}};
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+static volatile float    test_windup_overshoot{};
+static volatile float    test_back_calculation_overshoot{};
+static volatile float    test_unfiltered_noise{};
+static volatile float    test_filtered_noise{};
+static volatile uint32_t test_num_of_telemetries{};
+static volatile uint32_t test_bank_time_us{};
+static volatile uint32_t test_objects_time_us{};
+static volatile float    test_checksum{};
+
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+/**
+ * @brief Count the telemetries of the bank and keep the last one.
+ *
+ * @param context Last telemetry of the bank.
+ * @param telemetry Terms of the last responses.
+ */
+static void on_telemetry(void* context, const core::TPidControllerBank<num_of_controllers>::Telemetry& telemetry) {
+    *static_cast<core::TPidControllerBank<num_of_controllers>::Telemetry*>(context) = telemetry;
+    test_num_of_telemetries = test_num_of_telemetries + 1;
+}
+
+int main(int argc, char* argv[]) {
+    TestCore::init(argc, argv);
+    proxy::Argb      argb{argb_config};
+    proxy::Stopwatch stopwatch{stopwatch_config};
+
+    core::TPidControllerBank<num_of_controllers>            bank{configs};
+    core::TPidControllerBank<num_of_controllers>::Telemetry last_telemetry{};
+    bank.set_telemetry_callback(on_telemetry, &last_telemetry);
+    bank.set_setpoints({1.0F, 1.0F, 1.0F, 1.0F});
+
+    // Each controller drives a first order plant to a unit step, with the noisy ones measured with noise
+    std::minstd_rand                      generator{1};
+    std::normal_distribution<float>       noise{0.0F, measure_noise};
+    std::array<float, num_of_controllers> plant_states{};
+    std::array<float, num_of_controllers> max_states{};
+    std::array<float, num_of_controllers> last_responses{};
+    std::array<float, num_of_controllers> response_change_sums{};
+
+    for (uint16_t i = 0; i < num_of_response_samples; i++) {
+        std::array<float, num_of_controllers> measures = plant_states;
+        measures[2] += noise(generator);
+        measures[3] = measures[2] - plant_states[2] + plant_states[3];
+
+        const auto& responses = bank.update(measures, sample_time);
+
+        for (uint8_t j = 0; j < num_of_controllers; j++) {
+            plant_states[j] += sample_time * (responses[j] - plant_states[j]) / plant_time_constant;
+            max_states[j] = std::max(max_states[j], plant_states[j]);
+
+            if (i >= num_of_response_samples / 2) {
+                response_change_sums[j] += std::pow(responses[j] - last_responses[j], 2.0F);
+            }
+
+            last_responses[j] = responses[j];
+        }
+    }
+
+    test_windup_overshoot = max_states[0] - 1.0F;
+    test_back_calculation_overshoot = max_states[1] - 1.0F;
+    test_unfiltered_noise = std::sqrt(2.0F * response_change_sums[2] / num_of_response_samples);
+    test_filtered_noise = std::sqrt(2.0F * response_change_sums[3] / num_of_response_samples);
+
+    const bool telemetry_matches = test_num_of_telemetries == num_of_response_samples and
+                                   last_telemetry.responses == last_responses;
+
+    // The bank is timed against the same controllers as separate objects
+    bank.set_telemetry_callback(nullptr, nullptr);
+    auto controllers = core::make_array<core::PidController, num_of_controllers>(
+        core::PidController::Config{.kp = 2.0F, .ki = 20.0F, .kd = 0.01F, .setpoint = 1.0F, .saturation = saturation}
+    );
+    float checksum{};
+
+    stopwatch.reset_us();
+
+    for (uint32_t i = 0; i < num_of_benchmark_samples; i++) {
+        std::array<float, num_of_controllers> measures{};
+        measures.fill(static_cast<float>(i & 1U));
+        checksum += bank.update(measures, sample_time)[0];
+    }
+
+    test_bank_time_us = stopwatch.elapsed_time_us();
+    stopwatch.reset_us();
+
+    for (uint32_t i = 0; i < num_of_benchmark_samples; i++) {
+        for (auto& controller : controllers) {
+            checksum -= controller.compute_response(static_cast<float>(i & 1U), sample_time);
+        }
+    }
+
+    test_objects_time_us = stopwatch.elapsed_time_us();
+    test_checksum = checksum;
+
+    const bool passed = test_back_calculation_overshoot <= max_overshoot and
+                        test_back_calculation_overshoot < test_windup_overshoot and
+                        test_filtered_noise < test_unfiltered_noise / 2.0F and telemetry_matches;
+
+    argb.set_color(passed ? proxy::Argb::Colors::green : proxy::Argb::Colors::red);
+
+    TestCore::loop([]() { });
+
+    return 0;
+}
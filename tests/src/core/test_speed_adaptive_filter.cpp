@@ -0,0 +1,117 @@
+/**
+ * @file
+ */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <utility>
+
+#include "constants.hpp"
+#include "test_core.hpp"
+
+using namespace micras;  // NOLINT(google-build-using-namespace)
+
+static constexpr float                frame_time{0.001F};
+static constexpr float                post_position{0.1F};
+static constexpr float                post_transition{0.01F};
+static constexpr float                base_reading{0.4F};
+static constexpr float                reading_noise{0.002F};
+static constexpr float                run_length{0.2F};
+static constexpr std::array<float, 6> speeds{0.1F, 0.3F, 0.6F, 1.0F, 1.5F, 2.0F};
+static constexpr float                max_adaptive_error{0.003F};
+
+// NOLINTBEGIN(*-avoid-c-arrays, cppcoreguidelines-avoid-non-const-global-variables)
+static volatile float test_fixed_error[speeds.size()];
+static volatile float test_adaptive_error[speeds.size()];
+static volatile float test_max_fixed_error{};
+static volatile float test_max_adaptive_error{};
+
+// NOLINTEND(*-avoid-c-arrays, cppcoreguidelines-avoid-non-const-global-variables)
+
+/**
+ * @brief Get the reading of a side wall sensor passing by the end of a wall.
+ *
+ * @param position Position of the robot along the corridor in meters.
+ * @return Reading from the sensor.
+ */
+static float sensor_reading(float position) {
+    const float fraction = std::clamp((position - post_position) / post_transition, 0.0F, 1.0F);
+
+    return base_reading * (1.0F - fraction * fraction * (3.0F - 2.0F * fraction));
+}
+
+/**
+ * @brief Find the position where a filter sees the post, like the wall follower does.
+ *
+ * @tparam F Function updating the filter with a reading and returning the filtered reading and its lag.
+ * @param speed Linear speed of the robot in m/s.
+ * @param update_filter Function updating the filter.
+ * @return Position of the post seen by the filter, or infinity if it is never seen.
+ */
+template <typename F>
+static float find_post(float speed, F update_filter) {
+    std::minstd_rand                generator{1};
+    std::normal_distribution<float> noise{0.0F, reading_noise};
+    float                           last_reading{base_reading};
+
+    for (float position = 0.0F; position < run_length; position += speed * frame_time) {
+        const auto [reading, lag] = update_filter(sensor_reading(position) + noise(generator));
+
+        // The start is skipped, since the filters begin at zero
+        if (position > 0.5F * post_position and
+            -(reading - last_reading) / (speed * frame_time) >= follow_wall_config.post_threshold) {
+            return position - lag;
+        }
+
+        last_reading = reading;
+    }
+
+    return std::numeric_limits<float>::infinity();
+}
+
+int main(int argc, char* argv[]) {
+    TestCore::init(argc, argv);
+    proxy::Argb argb{argb_config};
+
+    std::array<float, speeds.size()> fixed_positions{};
+    std::array<float, speeds.size()> adaptive_positions{};
+
+    for (uint8_t i = 0; i < speeds.size(); i++) {
+        core::ButterworthFilter   fixed_filter{wall_sensors_config.filter.min_cutoff, 1.0F / frame_time};
+        core::SpeedAdaptiveFilter adaptive_filter{wall_sensors_config.filter};
+
+        fixed_positions.at(i) = find_post(speeds.at(i), [&fixed_filter](float reading) {
+            return std::pair{fixed_filter.update(reading), 0.0F};
+        });
+        adaptive_positions.at(i) = find_post(speeds.at(i), [&adaptive_filter, i](float reading) {
+            return std::pair{adaptive_filter.update(reading, speeds.at(i), frame_time), adaptive_filter.get_lag()};
+        });
+    }
+
+    float max_fixed_error{};
+    float max_error{};
+
+    // The errors are relative to the slowest run, since the threshold itself sees the post after its start, and the
+    // fixed filter delays the readings so much at high speeds that it may not see the post at all
+    for (uint8_t i = 0; i < speeds.size(); i++) {
+        test_fixed_error[i] = fixed_positions.at(i) - fixed_positions.at(0);
+        test_adaptive_error[i] = adaptive_positions.at(i) - adaptive_positions.at(0);
+        max_fixed_error = std::max(max_fixed_error, std::abs(fixed_positions.at(i) - fixed_positions.at(0)));
+        max_error = std::max(max_error, std::abs(adaptive_positions.at(i) - adaptive_positions.at(0)));
+    }
+
+    test_max_fixed_error = max_fixed_error;
+    test_max_adaptive_error = max_error;
+
+    const bool passed =
+        test_max_adaptive_error <= max_adaptive_error and test_max_adaptive_error < test_max_fixed_error;
+
+    argb.set_color(passed ? proxy::Argb::Colors::green : proxy::Argb::Colors::red);
+
+    TestCore::loop([]() { });
+
+    return 0;
+}
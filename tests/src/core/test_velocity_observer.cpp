@@ -0,0 +1,109 @@
+/**
+ * @file
+ */
+
+#include <cmath>
+#include <numbers>
+#include <random>
+
+#include "constants.hpp"
+#include "test_core.hpp"
+
+using namespace micras;  // NOLINT(google-build-using-namespace)
+
+static constexpr float    sample_time{loop_time_us / 1e6F};
+static constexpr uint16_t num_of_samples{3000};
+static constexpr float    encoder_resolution{2.0F * std::numbers::pi_v<float> * 0.0112F / 4096.0F};
+static constexpr float    encoder_noise{2.0F * encoder_resolution};
+static constexpr float    motor_time_constant{0.01F};
+static constexpr float    acceleration_gain{0.9F};
+static constexpr float    max_lag_ratio{0.25F};
+static constexpr float    max_noise{0.005F};
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+static volatile float test_filter_lag_error{};
+static volatile float test_observer_lag_error{};
+static volatile float test_filter_noise{};
+static volatile float test_observer_noise{};
+
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+/**
+ * @brief Get the acceleration commanded at a time of the synthetic run.
+ *
+ * @param time Time since the start of the run in seconds.
+ * @return The commanded acceleration in m/s^2.
+ */
+static float commanded_acceleration(float time) {
+    if (time < 0.5F) {
+        return 3.0F;
+    }
+
+    if (time > 2.0F and time < 2.5F) {
+        return -3.0F;
+    }
+
+    return 0.0F;
+}
+
+int main(int argc, char* argv[]) {
+    TestCore::init(argc, argv);
+    proxy::Argb argb{argb_config};
+
+    core::ButterworthFilter         filter{odometry_config.linear_cutoff_frequency};
+    core::VelocityObserver          observer{odometry_config.linear_observer};
+    std::minstd_rand                generator{1};
+    std::normal_distribution<float> noise{0.0F, encoder_noise};
+
+    float    acceleration{};
+    float    velocity{};
+    float    position{};
+    float    last_measurement{};
+    float    filter_lag_error_sum{};
+    float    observer_lag_error_sum{};
+    float    filter_noise_sum{};
+    float    observer_noise_sum{};
+    uint16_t num_of_ramp_samples{};
+    uint16_t num_of_cruise_samples{};
+
+    // The real acceleration lags the commanded one and is smaller, as if the feed-forward was not well calibrated
+    for (uint16_t i = 0; i < num_of_samples; i++) {
+        const float time = i * sample_time;
+        const float command = commanded_acceleration(time);
+
+        acceleration += (acceleration_gain * command - acceleration) * sample_time / motor_time_constant;
+        velocity += acceleration * sample_time;
+        position += velocity * sample_time;
+
+        const float measurement = std::round((position + noise(generator)) / encoder_resolution) * encoder_resolution;
+        const float displacement = measurement - last_measurement;
+        last_measurement = measurement;
+
+        const float filter_velocity = filter.update(displacement / sample_time);
+        const float observer_velocity = observer.update(displacement, command, sample_time);
+
+        if (time < 0.6F) {
+            filter_lag_error_sum += std::abs(filter_velocity - velocity);
+            observer_lag_error_sum += std::abs(observer_velocity - velocity);
+            num_of_ramp_samples++;
+        } else if (time > 1.0F and time < 2.0F) {
+            filter_noise_sum += std::pow(filter_velocity - velocity, 2.0F);
+            observer_noise_sum += std::pow(observer_velocity - velocity, 2.0F);
+            num_of_cruise_samples++;
+        }
+    }
+
+    test_filter_lag_error = filter_lag_error_sum / num_of_ramp_samples;
+    test_observer_lag_error = observer_lag_error_sum / num_of_ramp_samples;
+    test_filter_noise = std::sqrt(filter_noise_sum / num_of_cruise_samples);
+    test_observer_noise = std::sqrt(observer_noise_sum / num_of_cruise_samples);
+
+    const bool passed = test_observer_lag_error <= max_lag_ratio * test_filter_lag_error and
+                        test_observer_noise <= max_noise;
+
+    argb.set_color(passed ? proxy::Argb::Colors::green : proxy::Argb::Colors::red);
+
+    TestCore::loop([]() { });
+
+    return 0;
+}
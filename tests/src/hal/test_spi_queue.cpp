@@ -0,0 +1,175 @@
+/**
+ * @file
+ */
+
+#include <array>
+#include <span>
+#include <vector>
+
+#include "micras/hal/spi_queue.hpp"
+#include "test_core.hpp"
+
+using namespace micras;  // NOLINT(google-build-using-namespace)
+
+static constexpr uint16_t max_steps{1000};
+
+/**
+ * @brief Events of the transactions on the mock bus.
+ */
+struct Event {
+    enum Type : uint8_t {
+        SELECT = 0,
+        START = 1,
+        UNSELECT = 2,
+        CALLBACK = 3,
+    };
+
+    Type    type;
+    uint8_t device;
+    uint8_t tag;
+
+    bool operator==(const Event& other) const = default;
+};
+
+/**
+ * @brief Mock of a bus shared by devices, taking a step to transfer each byte.
+ */
+struct MockBus {
+    uint8_t            selected_device{};
+    uint16_t           remaining_bytes{};
+    bool               failed{};
+    std::vector<Event> events;
+};
+
+/**
+ * @brief Mock of a device on the bus, recording its events and answering with its data inverted.
+ */
+class MockDevice {
+public:
+    MockDevice(MockBus& bus, uint8_t id) : bus{&bus}, id{id} { }
+
+    bool select_device() {
+        if (this->bus->selected_device != 0 or this->bus->remaining_bytes > 0) {
+            return false;
+        }
+
+        this->bus->selected_device = this->id;
+        this->bus->events.push_back({Event::SELECT, this->id, 0});
+        return true;
+    }
+
+    void unselect_device() {
+        this->bus->failed |= this->bus->selected_device != this->id or this->bus->remaining_bytes > 0;
+        this->bus->selected_device = 0;
+        this->bus->events.push_back({Event::UNSELECT, this->id, 0});
+    }
+
+    bool transfer_dma(std::span<uint8_t> tx_data, std::span<uint8_t> rx_data) {
+        this->bus->failed |= this->bus->selected_device != this->id or tx_data.size() != rx_data.size();
+
+        for (uint16_t i = 0; i < tx_data.size(); i++) {
+            rx_data[i] = ~tx_data[i];
+        }
+
+        this->bus->remaining_bytes = tx_data.size();
+        this->bus->events.push_back({Event::START, this->id, tx_data[0]});
+        return true;
+    }
+
+    bool is_busy() const { return this->bus->remaining_bytes > 0; }
+
+private:
+    MockBus* bus;
+    uint8_t  id;
+};
+
+using SpiQueue = hal::TSpiQueue<MockDevice, 3>;
+
+/**
+ * @brief Context of the callbacks, chaining a transaction after the first one.
+ */
+struct Context {
+    MockBus*           bus;
+    SpiQueue*          queue;
+    MockDevice*        device;
+    std::span<uint8_t> tx_data;
+    std::span<uint8_t> rx_data;
+};
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+static volatile bool     test_order_passed{};
+static volatile bool     test_data_passed{true};
+static volatile bool     test_full_passed{};
+static volatile uint16_t test_num_of_events{};
+
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+static void on_complete(void* context, std::span<uint8_t> rx_data) {
+    auto* bus = static_cast<MockBus*>(context);
+
+    test_data_passed = test_data_passed and rx_data[1] == 0xFF;
+    bus->events.push_back({Event::CALLBACK, 0, static_cast<uint8_t>(~rx_data[0])});
+}
+
+static void on_complete_and_chain(void* context, std::span<uint8_t> rx_data) {
+    auto* chain = static_cast<Context*>(context);
+
+    on_complete(chain->bus, rx_data);
+    chain->queue->push({chain->device, chain->tx_data, chain->rx_data, on_complete, chain->bus});
+}
+
+int main(int argc, char* argv[]) {
+    TestCore::init(argc, argv);
+    proxy::Argb argb{argb_config};
+
+    MockBus    bus;
+    MockDevice first_device{bus, 1};
+    MockDevice second_device{bus, 2};
+    MockDevice third_device{bus, 3};
+    SpiQueue   first_queue;
+    SpiQueue   second_queue;
+
+    std::array<std::array<uint8_t, 2>, 4> tx_buffers{{{1, 0}, {2, 0}, {3, 0}, {4, 0}}};
+    std::array<std::array<uint8_t, 2>, 4> rx_buffers{};
+
+    Context chain{&bus, &first_queue, &first_device, tx_buffers[3], rx_buffers[3]};
+
+    // The third transaction shares the bus with the first queue, so it waits for it to be idle
+    first_queue.push({&first_device, tx_buffers[0], rx_buffers[0], on_complete_and_chain, &chain});
+    first_queue.push({&second_device, tx_buffers[1], rx_buffers[1], on_complete, &bus});
+    second_queue.push({&third_device, tx_buffers[2], rx_buffers[2], on_complete, &bus});
+
+    // Each step transfers one byte, as if the DMA were running while the loop computes
+    for (uint16_t step = 0; step < max_steps and not(first_queue.is_idle() and second_queue.is_idle()); step++) {
+        if (bus.remaining_bytes > 0) {
+            bus.remaining_bytes--;
+        }
+
+        first_queue.process();
+        second_queue.process();
+    }
+
+    const std::vector<Event> expected_events{
+        {Event::SELECT, 1, 0}, {Event::START, 1, 1}, {Event::UNSELECT, 1, 0}, {Event::CALLBACK, 0, 1},
+        {Event::SELECT, 2, 0}, {Event::START, 2, 2}, {Event::UNSELECT, 2, 0}, {Event::CALLBACK, 0, 2},
+        {Event::SELECT, 1, 0}, {Event::START, 1, 4}, {Event::UNSELECT, 1, 0}, {Event::CALLBACK, 0, 4},
+        {Event::SELECT, 3, 0}, {Event::START, 3, 3}, {Event::UNSELECT, 3, 0}, {Event::CALLBACK, 0, 3},
+    };
+
+    test_order_passed = not bus.failed and bus.events == expected_events;
+    test_num_of_events = bus.events.size();
+
+    first_queue.push({&first_device, tx_buffers[0], rx_buffers[0], nullptr, nullptr});
+    first_queue.push({&first_device, tx_buffers[1], rx_buffers[1], nullptr, nullptr});
+    first_queue.push({&first_device, tx_buffers[2], rx_buffers[2], nullptr, nullptr});
+    test_full_passed = not first_queue.push({&first_device, tx_buffers[3], rx_buffers[3], nullptr, nullptr}) and
+                       first_queue.size() == 3;
+
+    const bool passed = test_order_passed and test_data_passed and test_full_passed;
+
+    argb.set_color(passed ? proxy::Argb::Colors::green : proxy::Argb::Colors::red);
+
+    TestCore::loop([]() { });
+
+    return 0;
+}
@@ -0,0 +1,82 @@
+/**
+ * @file
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <list>
+#include <numbers>
+
+#include "constants.hpp"
+#include "test_core.hpp"
+
+using namespace micras;  // NOLINT(google-build-using-namespace)
+
+static constexpr float sample_time{loop_time_us / 1e6F};
+static constexpr float max_duration{10.0F};
+static constexpr float max_edge_error{0.005F};
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+static volatile float    test_edge_error{};
+static volatile uint16_t test_num_of_straights{};
+
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+int main(int argc, char* argv[]) {
+    TestCore::init(argc, argv);
+    proxy::Argb       argb{argb_config};
+    nav::ActionQueuer action_queuer{action_queuer_config};
+
+    // Straights starting after the start and after turns, whose exits are not on the cell edges
+    const std::list<nav::GridPose> route{
+        {{0, 0}, nav::Side::UP},    {{0, 1}, nav::Side::UP},    {{0, 2}, nav::Side::UP},
+        {{0, 3}, nav::Side::UP},    {{1, 3}, nav::Side::RIGHT}, {{2, 3}, nav::Side::RIGHT},
+        {{3, 3}, nav::Side::RIGHT}, {{3, 4}, nav::Side::UP},    {{4, 4}, nav::Side::RIGHT},
+        {{5, 4}, nav::Side::RIGHT}, {{6, 4}, nav::Side::RIGHT},
+    };
+
+    action_queuer.recompute(route);
+
+    // The maze origin is at the corner of the start cell, so the cell edges are at multiples of the cell size
+    nav::Pose         pose{{cell_size / 2.0F, start_offset}, std::numbers::pi_v<float> / 2.0F};
+    nav::RelativePose action_pose{pose};
+    float             time{};
+
+    action_pose.reset_reference();
+
+    while (not action_queuer.empty() and time < max_duration) {
+        const auto action = action_queuer.pop();
+
+        if (action->allow_follow_wall()) {
+            const core::Vector direction = action_pose.get_direction();
+            const core::Vector edge = action_pose.to_absolute({action->get_cell_edge(), 0.0F});
+            const float        edge_advance = direction.x * edge.x + direction.y * edge.y;
+
+            test_edge_error = std::max(
+                static_cast<float>(test_edge_error), std::abs(std::remainder(edge_advance, cell_size))
+            );
+            test_num_of_straights = test_num_of_straights + 1;
+        }
+
+        while (not action->finished(action_pose.get()) and time < max_duration) {
+            const nav::Twist twist = action->get_speeds(action_pose.get());
+            const float      linear_distance = twist.linear * sample_time;
+            const float      half_angle = twist.angular * sample_time / 2.0F;
+
+            pose.position.x += linear_distance * std::cos(pose.orientation + half_angle);
+            pose.position.y += linear_distance * std::sin(pose.orientation + half_angle);
+            pose.orientation += 2.0F * half_angle;
+            time += sample_time;
+        }
+
+        action_pose.continue_reference(action->get_residual_pose(action_pose.get()));
+    }
+
+    const bool passed = time < max_duration and test_num_of_straights >= 3 and test_edge_error <= max_edge_error;
+
+    argb.set_color(passed ? proxy::Argb::Colors::green : proxy::Argb::Colors::red);
+
+    TestCore::loop([]() { });
+
+    return 0;
+}
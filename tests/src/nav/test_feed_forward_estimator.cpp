@@ -0,0 +1,124 @@
+/**
+ * @file
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <random>
+
+#include "constants.hpp"
+#include "test_core.hpp"
+
+using namespace micras;  // NOLINT(google-build-using-namespace)
+
+static constexpr float    sample_time{loop_time_us / 1e6F};
+static constexpr uint32_t num_of_samples{20000};
+static constexpr float    speed_noise{0.01F};
+static constexpr float    command_noise{0.2F};
+static constexpr float    max_speed_gain_error{0.01F};
+static constexpr float    max_acceleration_gain_error{0.05F};
+
+// The robot drifts away from the configured gains, as with a lower battery voltage
+static const nav::FeedForwardEstimator::FeedForward left_gains{
+    .linear_speed = 14.0F, .linear_acceleration = 3.2F, .angular_speed = -1.1F, .angular_acceleration = -0.03F
+};
+static const nav::FeedForwardEstimator::FeedForward right_gains{
+    .linear_speed = 14.5F, .linear_acceleration = 3.3F, .angular_speed = 1.0F, .angular_acceleration = -0.03F
+};
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+static volatile float test_left_speed_gain_error{};
+static volatile float test_right_speed_gain_error{};
+static volatile float test_left_acceleration_gain_error{};
+static volatile float test_right_acceleration_gain_error{};
+static volatile bool  test_restored{};
+static volatile bool  test_rejected{};
+
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+/**
+ * @brief Calculate the command of a wheel from its gains.
+ *
+ * @param gains Feed-forward gains of the wheel.
+ * @param speed Speeds of the robot.
+ * @param acceleration Accelerations of the robot.
+ * @return Command of the wheel.
+ */
+static float wheel_command(
+    const nav::FeedForwardEstimator::FeedForward& gains, const nav::Twist& speed, const nav::Twist& acceleration
+) {
+    return gains.linear_speed * speed.linear + gains.linear_acceleration * acceleration.linear +
+           gains.angular_speed * speed.angular + gains.angular_acceleration * acceleration.angular;
+}
+
+int main(int argc, char* argv[]) {
+    TestCore::init(argc, argv);
+    proxy::Argb argb{argb_config};
+
+    nav::FeedForwardEstimator estimator{
+        feed_forward_estimator_config, speed_controller_config.left_feed_forward,
+        speed_controller_config.right_feed_forward
+    };
+
+    std::minstd_rand                generator{1};
+    std::normal_distribution<float> noise{0.0F, 1.0F};
+
+    // The speeds follow waves of different frequencies, so the speeds and accelerations are not correlated
+    for (uint32_t i = 0; i < num_of_samples; i++) {
+        const float      time = i * sample_time;
+        const float      linear_phase = 2.0F * std::numbers::pi_v<float> * 0.7F * time;
+        const float      angular_phase = 2.0F * std::numbers::pi_v<float> * 1.3F * time;
+        const nav::Twist speed{0.5F + 0.3F * std::sin(linear_phase), 3.0F * std::sin(angular_phase)};
+        const nav::Twist acceleration{
+            0.3F * 2.0F * std::numbers::pi_v<float> * 0.7F * std::cos(linear_phase),
+            3.0F * 2.0F * std::numbers::pi_v<float> * 1.3F * std::cos(angular_phase)
+        };
+        const nav::Twist measured_speed{
+            speed.linear + speed_noise * noise(generator), speed.angular + speed_noise * noise(generator)
+        };
+
+        estimator.update(
+            measured_speed, wheel_command(left_gains, speed, acceleration) + command_noise * noise(generator),
+            wheel_command(right_gains, speed, acceleration) + command_noise * noise(generator), sample_time
+        );
+    }
+
+    const auto& left_estimate = estimator.get_left_feed_forward();
+    const auto& right_estimate = estimator.get_right_feed_forward();
+
+    test_left_speed_gain_error = std::abs(left_estimate.linear_speed / left_gains.linear_speed - 1.0F);
+    test_right_speed_gain_error = std::abs(right_estimate.linear_speed / right_gains.linear_speed - 1.0F);
+    test_left_acceleration_gain_error =
+        std::abs(left_estimate.linear_acceleration / left_gains.linear_acceleration - 1.0F);
+    test_right_acceleration_gain_error =
+        std::abs(right_estimate.linear_acceleration / right_gains.linear_acceleration - 1.0F);
+
+    // The saved gains are restored by another estimator, while corrupted ones are discarded
+    const auto serialized = estimator.serialize();
+
+    nav::FeedForwardEstimator restored{
+        feed_forward_estimator_config, speed_controller_config.left_feed_forward,
+        speed_controller_config.right_feed_forward
+    };
+    restored.deserialize(serialized.data(), serialized.size());
+    test_restored = restored.get_left_feed_forward().linear_speed == left_estimate.linear_speed and
+                    restored.get_right_feed_forward().linear_acceleration == right_estimate.linear_acceleration;
+
+    auto corrupted = serialized;
+    std::fill(corrupted.begin(), corrupted.begin() + sizeof(float), 0xFF);
+    restored.deserialize(corrupted.data(), corrupted.size());
+    test_rejected = restored.get_left_feed_forward().linear_speed == left_estimate.linear_speed;
+
+    const bool passed = test_left_speed_gain_error <= max_speed_gain_error and
+                        test_right_speed_gain_error <= max_speed_gain_error and
+                        test_left_acceleration_gain_error <= max_acceleration_gain_error and
+                        test_right_acceleration_gain_error <= max_acceleration_gain_error and test_restored and
+                        test_rejected;
+
+    argb.set_color(passed ? proxy::Argb::Colors::green : proxy::Argb::Colors::red);
+
+    TestCore::loop([]() { });
+
+    return 0;
+}
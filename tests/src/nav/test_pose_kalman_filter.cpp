@@ -0,0 +1,94 @@
+/**
+ * @file
+ */
+
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+
+#include "constants.hpp"
+#include "test_core.hpp"
+
+using namespace micras;  // NOLINT(google-build-using-namespace)
+
+static constexpr float sample_time{loop_time_us / 1e6F};
+static constexpr float run_duration{6.0F};
+static constexpr float gyro_bias{0.02F};
+static constexpr float imu_gyro_bias{0.015F};
+static constexpr float encoder_resolution{0.0112F * 2.0F * std::numbers::pi_v<float> / 4096.0F};
+static constexpr float wall_orientation_deviation{0.02F};
+static constexpr float max_position_error_ratio{0.1F};
+static constexpr float max_gyro_bias_error{0.005F};
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+static volatile float test_dead_reckoning_error{};
+static volatile float test_kalman_filter_error{};
+static volatile float test_gyro_bias{};
+
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+int main(int argc, char* argv[]) {
+    TestCore::init(argc, argv);
+    proxy::Argb           argb{argb_config};
+    nav::PoseKalmanFilter kalman_filter{odometry_config.kalman_filter, {{0.0F, 0.0F}, 0.0F}};
+
+    nav::Pose pose{{0.0F, 0.0F}, 0.0F};
+    nav::Pose dead_reckoning{{0.0F, 0.0F}, 0.0F};
+    float     speed{};
+    float     encoder_position{};
+    float     last_encoder_position{};
+    int32_t   last_cell{};
+    float     removed_gyro_bias{};
+
+    // A winding run with a biased gyroscope, where the walls give a noisy heading at every cell
+    for (float time = 0.0F; time < run_duration; time += sample_time) {
+        const float acceleration = speed < exploration_speed ? max_linear_acceleration : 0.0F;
+        const float angular_speed = 0.5F * std::sin(time);
+
+        pose.position.x += speed * sample_time * std::cos(pose.orientation);
+        pose.position.y += speed * sample_time * std::sin(pose.orientation);
+        pose.orientation += angular_speed * sample_time;
+        speed += acceleration * sample_time;
+
+        encoder_position += speed * sample_time;
+        const float measured_position = std::floor(encoder_position / encoder_resolution) * encoder_resolution;
+        const float measured_speed = (measured_position - last_encoder_position) / sample_time;
+        last_encoder_position = measured_position;
+
+        // Halfway, the IMU starts removing most of the bias, as when it is estimated in a stop
+        if (time >= run_duration / 2.0F and removed_gyro_bias == 0.0F) {
+            removed_gyro_bias = imu_gyro_bias;
+            kalman_filter.shift_gyro_bias(-imu_gyro_bias);
+        }
+
+        const float gyro_reading = angular_speed + gyro_bias - removed_gyro_bias;
+
+        dead_reckoning.position.x += measured_speed * sample_time * std::cos(dead_reckoning.orientation);
+        dead_reckoning.position.y += measured_speed * sample_time * std::sin(dead_reckoning.orientation);
+        dead_reckoning.orientation += (angular_speed + gyro_bias) * sample_time;
+
+        kalman_filter.predict(acceleration, sample_time);
+        kalman_filter.update_linear_speed(measured_speed);
+        kalman_filter.update_angular_speed(gyro_reading);
+
+        if (const auto cell = static_cast<int32_t>(encoder_position / cell_size); cell != last_cell) {
+            last_cell = cell;
+            const float wall_noise = (cell % 2 == 0 ? 1.0F : -1.0F) * wall_orientation_deviation;
+
+            kalman_filter.correct_orientation(pose.orientation + wall_noise, wall_orientation_deviation);
+        }
+    }
+
+    test_dead_reckoning_error = dead_reckoning.position.distance(pose.position);
+    test_kalman_filter_error = kalman_filter.get_state().pose.position.distance(pose.position);
+    test_gyro_bias = kalman_filter.get_gyro_bias();
+
+    const bool passed = test_kalman_filter_error <= max_position_error_ratio * test_dead_reckoning_error and
+                        std::abs(test_gyro_bias - (gyro_bias - imu_gyro_bias)) <= max_gyro_bias_error;
+
+    argb.set_color(passed ? proxy::Argb::Colors::green : proxy::Argb::Colors::red);
+
+    TestCore::loop([]() { });
+
+    return 0;
+}
@@ -0,0 +1,76 @@
+/**
+ * @file
+ */
+
+#include <cmath>
+#include <list>
+#include <numbers>
+
+#include "constants.hpp"
+#include "test_core.hpp"
+
+using namespace micras;  // NOLINT(google-build-using-namespace)
+
+static constexpr float max_straight_error{0.05F};
+static constexpr float max_orientation_error{0.01F};
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+static volatile float test_straight_time{};
+static volatile float test_profile_time{};
+static volatile float test_turn_time{};
+static volatile float test_turn_orientation{};
+
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+int main(int argc, char* argv[]) {
+    TestCore::init(argc, argv);
+    proxy::Argb             argb{argb_config};
+    nav::RouteTimeEstimator route_time_estimator{action_queuer_config, route_time_estimator_config};
+
+    const auto& exploring = action_queuer_config.exploring;
+    const auto& solving = action_queuer_config.solving;
+
+    const std::list<nav::GridPose> straight_route{
+        {{0, 0}, nav::Side::UP},
+        {{0, 1}, nav::Side::UP},
+        {{0, 2}, nav::Side::UP},
+        {{0, 3}, nav::Side::UP},
+    };
+
+    const std::list<nav::GridPose> turn_route{
+        {{0, 0}, nav::Side::UP},    {{0, 1}, nav::Side::UP},    {{0, 2}, nav::Side::UP},
+        {{1, 2}, nav::Side::RIGHT}, {{2, 2}, nav::Side::RIGHT},
+    };
+
+    const nav::SCurveMoveAction straight_profile{
+        0,
+        3.5F * cell_size - start_offset,
+        0.001F * solving.max_linear_acceleration,
+        0.0F,
+        solving.max_linear_speed,
+        solving.max_linear_acceleration,
+        solving.max_linear_deceleration,
+        solving.max_linear_jerk,
+    };
+
+    const nav::TurnAction turn{
+        0, std::numbers::pi_v<float> / 2.0F, exploring.curve_radius, exploring.max_linear_speed,
+        exploring.max_angular_acceleration
+    };
+
+    test_straight_time = route_time_estimator.estimate(straight_route);
+    test_profile_time = straight_profile.get_duration();
+    test_turn_time = route_time_estimator.estimate(turn_route);
+    test_turn_orientation = turn.preview(route_time_estimator_config.sample_time).end_pose.orientation;
+
+    const bool passed =
+        std::abs(test_straight_time - test_profile_time) <= max_straight_error * test_profile_time and
+        test_turn_time > test_straight_time and
+        std::abs(test_turn_orientation - std::numbers::pi_v<float> / 2.0F) <= max_orientation_error;
+
+    argb.set_color(passed ? proxy::Argb::Colors::green : proxy::Argb::Colors::red);
+
+    TestCore::loop([]() { });
+
+    return 0;
+}
@@ -0,0 +1,126 @@
+/**
+ * @file
+ */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <initializer_list>
+#include <numbers>
+
+#include "constants.hpp"
+#include "test_core.hpp"
+
+using namespace micras;  // NOLINT(google-build-using-namespace)
+
+static constexpr uint16_t table_size{nav::ActionQueuer::profile_table_size};
+static constexpr uint16_t num_of_samples{1000};
+static constexpr float    sample_time{0.001F};
+static constexpr float    max_linear_error{0.005F};
+static constexpr float    max_angular_error{0.25F};
+static constexpr float    max_duration_error{0.005F};
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+static volatile float test_linear_error{};
+static volatile float test_angular_error{};
+static volatile float test_duration_error{};
+
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+/**
+ * @brief Compare a tabulated move action against the analytic one.
+ *
+ * @param analytic Action computing the profile on every call.
+ * @param tabulated Action interpolating the profile from its table.
+ * @param distance Distance of the actions in meters.
+ */
+static void compare_move(const nav::Action& analytic, const nav::Action& tabulated, float distance) {
+    for (uint16_t i = 0; i < num_of_samples; i++) {
+        const nav::Pose pose{{distance * i / num_of_samples, 0.0F}, 0.0F};
+        const float     error = std::abs(analytic.get_speeds(pose).linear - tabulated.get_speeds(pose).linear);
+        test_linear_error = std::max(static_cast<float>(test_linear_error), error);
+    }
+
+    const float duration_error =
+        std::abs(analytic.preview(sample_time).duration - tabulated.preview(sample_time).duration);
+    test_duration_error = std::max(static_cast<float>(test_duration_error), duration_error);
+}
+
+/**
+ * @brief Compare a tabulated turn action against the analytic one.
+ *
+ * @param analytic Action computing the profile on every call.
+ * @param tabulated Action interpolating the profile from its table.
+ * @param angle Angle of the actions in radians.
+ */
+static void compare_turn(const nav::Action& analytic, const nav::Action& tabulated, float angle) {
+    for (uint16_t i = 0; i < num_of_samples; i++) {
+        const nav::Pose pose{{0.0F, 0.0F}, angle * i / num_of_samples};
+        const float     error = std::abs(analytic.get_speeds(pose).angular - tabulated.get_speeds(pose).angular);
+        test_angular_error = std::max(static_cast<float>(test_angular_error), error);
+    }
+
+    const float duration_error =
+        std::abs(analytic.preview(sample_time).duration - tabulated.preview(sample_time).duration);
+    test_duration_error = std::max(static_cast<float>(test_duration_error), duration_error);
+}
+
+int main(int argc, char* argv[]) {
+    TestCore::init(argc, argv);
+    proxy::Argb argb{argb_config};
+
+    const auto& exploring = action_queuer_config.exploring;
+    const auto& solving = action_queuer_config.solving;
+
+    for (const auto& [distance, start_speed, end_speed] : std::initializer_list<std::array<float, 3>>{
+             {cell_size, exploring.max_linear_speed, exploring.max_linear_speed},
+             {cell_size / 2.0F, exploring.max_linear_speed, 0.0F},
+             {cell_size / 2.0F, 0.001F * exploring.max_linear_acceleration, exploring.max_linear_speed},
+         }) {
+        compare_move(
+            nav::MoveAction{
+                0, distance, start_speed, end_speed, exploring.max_linear_speed, exploring.max_linear_acceleration,
+                exploring.max_linear_deceleration
+            },
+            nav::TTabulatedMoveAction<nav::MoveAction, table_size>{
+                0, distance, start_speed, end_speed, exploring.max_linear_speed, exploring.max_linear_acceleration,
+                exploring.max_linear_deceleration
+            },
+            distance
+        );
+    }
+
+    compare_move(
+        nav::SCurveMoveAction{
+            0, 8.0F * cell_size, 0.001F * solving.max_linear_acceleration, 0.0F, solving.max_linear_speed,
+            solving.max_linear_acceleration, solving.max_linear_deceleration, solving.max_linear_jerk
+        },
+        nav::TTabulatedMoveAction<nav::SCurveMoveAction, table_size>{
+            0, 8.0F * cell_size, 0.001F * solving.max_linear_acceleration, 0.0F, solving.max_linear_speed,
+            solving.max_linear_acceleration, solving.max_linear_deceleration, solving.max_linear_jerk
+        },
+        8.0F * cell_size
+    );
+
+    for (const auto& [angle, curve_radius, linear_speed] : std::initializer_list<std::array<float, 3>>{
+             {std::numbers::pi_v<float> / 2.0F, cell_size / 2.0F, exploring.max_linear_speed},
+             {std::numbers::pi_v<float>, 0.0F, 0.0F},
+         }) {
+        compare_turn(
+            nav::TurnAction{0, angle, curve_radius, linear_speed, exploring.max_angular_acceleration},
+            nav::TTabulatedTurnAction<table_size>{
+                0, angle, curve_radius, linear_speed, exploring.max_angular_acceleration
+            },
+            angle
+        );
+    }
+
+    const bool passed = test_linear_error <= max_linear_error and test_angular_error <= max_angular_error and
+                        test_duration_error <= max_duration_error;
+
+    argb.set_color(passed ? proxy::Argb::Colors::green : proxy::Argb::Colors::red);
+
+    TestCore::loop([]() { });
+
+    return 0;
+}
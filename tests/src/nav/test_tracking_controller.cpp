@@ -0,0 +1,82 @@
+/**
+ * @file
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <list>
+#include <memory>
+
+#include "constants.hpp"
+#include "test_core.hpp"
+
+using namespace micras;  // NOLINT(google-build-using-namespace)
+
+static constexpr float sample_time{loop_time_us / 1e6F};
+static constexpr float max_duration{10.0F};
+static constexpr float curvature_disturbance{0.3F};
+static constexpr float max_tracking_error{0.01F};
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+static volatile float test_duration{};
+static volatile float test_tracking_error{};
+
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+int main(int argc, char* argv[]) {
+    TestCore::init(argc, argv);
+    proxy::Argb             argb{argb_config};
+    nav::ActionQueuer       action_queuer{action_queuer_config};
+    nav::TrackingController tracking_controller{tracking_controller_config};
+
+    // A zigzag run as a diagonal, where there are no walls to follow
+    const std::list<nav::GridPose> diagonal_route{
+        {{0, 0}, nav::Side::UP},    {{0, 1}, nav::Side::UP},    {{0, 2}, nav::Side::UP},
+        {{1, 2}, nav::Side::RIGHT}, {{1, 3}, nav::Side::UP},    {{2, 3}, nav::Side::RIGHT},
+        {{2, 4}, nav::Side::UP},    {{3, 4}, nav::Side::RIGHT}, {{3, 5}, nav::Side::UP},
+        {{3, 6}, nav::Side::UP},    {{3, 7}, nav::Side::UP},
+    };
+
+    action_queuer.recompute(diagonal_route);
+
+    nav::Pose         pose{{0.0F, 0.0F}, 0.0F};
+    nav::RelativePose action_pose{pose};
+    auto              action = action_queuer.pop();
+
+    while (test_duration < max_duration) {
+        if (action->finished(action_pose.get())) {
+            if (action_queuer.empty()) {
+                break;
+            }
+
+            action_pose.continue_reference(action->get_residual_pose(action_pose.get()));
+            action = action_queuer.pop();
+        }
+
+        const nav::Pose  current_pose = action_pose.get();
+        const nav::Pose  reference_pose = action->get_reference_pose(current_pose);
+        const nav::Twist twist =
+            tracking_controller.compute_speeds(current_pose, reference_pose, action->get_speeds(current_pose));
+
+        test_tracking_error = std::max(
+            static_cast<float>(test_tracking_error), (reference_pose.position - current_pose.position).magnitude()
+        );
+
+        // The robot drifts as if one of the wheels was larger than the other
+        const float linear_distance = twist.linear * sample_time;
+        const float half_angle = (twist.angular + curvature_disturbance * twist.linear) * sample_time / 2.0F;
+
+        pose.position.x += linear_distance * std::cos(pose.orientation + half_angle);
+        pose.position.y += linear_distance * std::sin(pose.orientation + half_angle);
+        pose.orientation += 2.0F * half_angle;
+        test_duration = test_duration + sample_time;
+    }
+
+    const bool passed = test_duration < max_duration and test_tracking_error <= max_tracking_error;
+
+    argb.set_color(passed ? proxy::Argb::Colors::green : proxy::Argb::Colors::red);
+
+    TestCore::loop([]() { });
+
+    return 0;
+}
@@ -0,0 +1,78 @@
+/**
+ * @file
+ */
+
+#include <cmath>
+#include <numbers>
+
+#include "constants.hpp"
+#include "test_core.hpp"
+
+using namespace micras;  // NOLINT(google-build-using-namespace)
+
+static constexpr float sample_time{loop_time_us / 1e6F};
+static constexpr float max_position_error{0.005F};
+static constexpr float max_orientation_error{0.01F};
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+static volatile float test_sequence_time{};
+static volatile float test_turn_back_time{};
+static volatile float test_position_error{};
+static volatile float test_orientation_error{};
+static volatile bool  test_early_rotation{};
+
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+int main(int argc, char* argv[]) {
+    TestCore::init(argc, argv);
+    proxy::Argb argb{argb_config};
+
+    const auto& exploring = action_queuer_config.exploring;
+    const auto& turn_back = action_queuer_config.turn_back;
+
+    // Stop at the center of the cell, turn in place and move back half a cell, each waiting for the previous one
+    const nav::MoveAction stop{
+        0, cell_size / 2.0F, exploring.max_linear_speed, 0.0F, exploring.max_linear_speed,
+        exploring.max_linear_acceleration, exploring.max_linear_deceleration, false
+    };
+    const nav::TurnAction turn{0, std::numbers::pi_v<float>, 0.0F, 0.0F, exploring.max_angular_acceleration};
+    const nav::MoveAction move_half{
+        0, cell_size / 2.0F, 0.001F * exploring.max_linear_acceleration, exploring.max_linear_speed,
+        exploring.max_linear_speed, exploring.max_linear_acceleration, exploring.max_linear_deceleration, false
+    };
+
+    const nav::TurnBackAction turn_back_action{
+        0, cell_size / 2.0F, cell_size / 2.0F, exploring.max_linear_speed, exploring.max_linear_speed,
+        exploring.max_linear_acceleration, exploring.max_linear_deceleration, turn_back.max_angular_speed,
+        exploring.max_angular_acceleration, turn_back.overlap_speed, turn_back.launch_angle
+    };
+
+    test_sequence_time = stop.preview(sample_time).duration + turn.preview(sample_time).duration +
+                         move_half.preview(sample_time).duration;
+
+    const nav::Action::Trajectory trajectory = turn_back_action.preview(sample_time);
+    test_turn_back_time = trajectory.duration;
+
+    // The robot must leave the cell through the same edge it entered
+    test_position_error = trajectory.end_pose.position.magnitude();
+    test_orientation_error = std::abs(trajectory.end_pose.orientation - std::numbers::pi_v<float>);
+
+    // The previous action and the gyro noise leave a small orientation, which must not start the rotation early
+    const float overlap_distance =
+        turn_back.overlap_speed * turn_back.overlap_speed / (2.0F * exploring.max_linear_deceleration);
+
+    for (float advance = 0.0F; advance < cell_size / 2.0F - overlap_distance; advance += 0.001F) {
+        if (turn_back_action.get_speeds({{advance, 0.0F}, 1e-3F}).angular != 0.0F) {
+            test_early_rotation = true;
+        }
+    }
+
+    const bool passed = test_turn_back_time < test_sequence_time and test_position_error <= max_position_error and
+                        test_orientation_error <= max_orientation_error and not test_early_rotation;
+
+    argb.set_color(passed ? proxy::Argb::Colors::green : proxy::Argb::Colors::red);
+
+    TestCore::loop([]() { });
+
+    return 0;
+}
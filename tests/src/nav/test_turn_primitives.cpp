@@ -0,0 +1,62 @@
+/**
+ * @file
+ */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include "constants.hpp"
+#include "test_core.hpp"
+
+using namespace micras;  // NOLINT(google-build-using-namespace)
+
+static constexpr float max_position_error{0.005F};
+static constexpr float max_orientation_error{0.01F};
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+static volatile float test_position_error{};
+static volatile float test_orientation_error{};
+
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+int main(int argc, char* argv[]) {
+    TestCore::init(argc, argv);
+    proxy::Argb argb{argb_config};
+
+    const auto& turns = action_queuer_config.turns;
+    const auto& solving = action_queuer_config.solving;
+
+    for (const auto& config : std::array<nav::TurnPrimitive::Config, 8>{
+             turns.search_90, turns.large_90, turns.u_turn_180, turns.in_45, turns.out_45, turns.in_135, turns.out_135,
+             turns.v_90
+         }) {
+        const nav::TurnPrimitive primitive{config};
+        const float              linear_speed =
+            primitive.get_max_speed(solving.max_centrifugal_acceleration, solving.max_angular_acceleration);
+        const nav::CurveAction curve{0, primitive, true, linear_speed};
+
+        const nav::Pose end_pose = curve.preview(route_time_estimator_config.sample_time).end_pose;
+
+        // The curve is placed between the straight entry and exit offsets
+        const float position_error = std::hypot(
+            primitive.get_entry_offset() + end_pose.position.x +
+                primitive.get_exit_offset() * std::cos(end_pose.orientation) - config.displacement.x,
+            end_pose.position.y + primitive.get_exit_offset() * std::sin(end_pose.orientation) - config.displacement.y
+        );
+
+        test_position_error = std::max(static_cast<float>(test_position_error), position_error);
+        test_orientation_error = std::max(
+            static_cast<float>(test_orientation_error), std::abs(end_pose.orientation - primitive.get_angle())
+        );
+    }
+
+    const bool passed =
+        test_position_error <= max_position_error and test_orientation_error <= max_orientation_error;
+
+    argb.set_color(passed ? proxy::Argb::Colors::green : proxy::Argb::Colors::red);
+
+    TestCore::loop([]() { });
+
+    return 0;
+}
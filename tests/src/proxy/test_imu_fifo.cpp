@@ -0,0 +1,125 @@
+/**
+ * @file
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <random>
+
+#include "constants.hpp"
+#include "lsm6dsv_mock.hpp"
+#include "micras/proxy/imu_fifo.hpp"
+#include "test_core.hpp"
+
+using namespace micras;  // NOLINT(google-build-using-namespace)
+
+static constexpr float    gyroscope_factor{std::numbers::pi_v<float> / 180000.0F * 4.375F * 32.0F};
+static constexpr float    accelerometer_factor{0.00980665F * 0.061F * 4.0F};
+static constexpr float    timestamp_resolution{21.75e-6F};
+static constexpr uint32_t sample_period{48};
+static constexpr float    loop_period{loop_time_us / 1e6F};
+static constexpr float    max_loop_delay{0.0003F};
+static constexpr float    stall_duration{0.02F};
+static constexpr float    run_duration{10.0F};
+static constexpr float    amplitude{10.0F};
+static constexpr float    frequency{5.0F};
+static constexpr float    max_heading_error{0.001F};
+static constexpr int16_t  raw_gravity{static_cast<int16_t>(9.80665F / accelerometer_factor)};
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+static volatile float    test_fifo_heading_error{};
+static volatile float    test_registers_heading_error{};
+static volatile uint32_t test_max_reads_per_update{};
+static volatile uint32_t test_lost_samples{};
+
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+// Heading of the simulated robot, turning back and forth
+static float heading(float time) {
+    return amplitude * (1.0F - std::cos(2.0F * std::numbers::pi_v<float> * frequency * time)) /
+           (2.0F * std::numbers::pi_v<float> * frequency);
+}
+
+static float angular_velocity(float time) {
+    return amplitude * std::sin(2.0F * std::numbers::pi_v<float> * frequency * time);
+}
+
+int main(int argc, char* argv[]) {
+    TestCore::init(argc, argv);
+    proxy::Argb    argb{argb_config};
+    Lsm6dsvMock    mock;
+    proxy::ImuFifo fifo{mock.get_context(), imu_config.fifo, gyroscope_factor, accelerometer_factor};
+
+    std::mt19937                          generator{42};
+    std::uniform_real_distribution<float> loop_delay{0.0F, max_loop_delay};
+
+    fifo.configure();
+
+    uint32_t timestamp{};
+    uint32_t num_of_pushed_samples{};
+    uint32_t num_of_read_samples{};
+    float    first_sample_time{-1.0F};
+    float    last_sample_time{};
+    float    fifo_heading{};
+    float    registers_heading{};
+    float    loop_time{};
+    float    last_read_time{};
+    bool     stalled{};
+
+    while (loop_time < run_duration) {
+        loop_time += loop_period;
+
+        // The loop stalls once, like during a storage write, and is late by a random delay every time
+        if (not stalled and loop_time > run_duration / 2.0F) {
+            loop_time += stall_duration;
+            stalled = true;
+        }
+
+        const float read_time = loop_time + loop_delay(generator);
+
+        while ((timestamp + sample_period) * timestamp_resolution <= read_time) {
+            timestamp += sample_period;
+
+            const float sample_time = timestamp * timestamp_resolution;
+            const float raw_velocity = std::round(angular_velocity(sample_time) / gyroscope_factor);
+
+            mock.push_timestamp(timestamp);
+            mock.push(Lsm6dsvMock::Tag::GYROSCOPE, {0, 0, static_cast<int16_t>(raw_velocity)});
+            mock.push(Lsm6dsvMock::Tag::ACCELEROMETER, {0, 0, raw_gravity});
+
+            if (first_sample_time < 0.0F) {
+                first_sample_time = sample_time;
+            }
+
+            last_sample_time = sample_time;
+            num_of_pushed_samples++;
+        }
+
+        const uint32_t num_of_reads = mock.get_num_of_reads();
+
+        fifo.update();
+
+        test_max_reads_per_update =
+            std::max(static_cast<uint32_t>(test_max_reads_per_update), mock.get_num_of_reads() - num_of_reads);
+        num_of_read_samples += fifo.get_num_of_gyroscope_samples();
+        fifo_heading += fifo.get_angular_displacement()[2];
+
+        // Reading only the latest sample from the registers holds it for the whole loop period
+        registers_heading += angular_velocity(last_sample_time) * (read_time - last_read_time);
+        last_read_time = read_time;
+    }
+
+    test_fifo_heading_error = std::abs(fifo_heading - (heading(last_sample_time) - heading(first_sample_time)));
+    test_registers_heading_error = std::abs(registers_heading - heading(last_read_time));
+    test_lost_samples = num_of_pushed_samples - num_of_read_samples - mock.get_fifo_level() / 3;
+
+    const bool passed = test_fifo_heading_error <= max_heading_error and test_max_reads_per_update <= 2 and
+                        test_lost_samples == 0 and test_fifo_heading_error < test_registers_heading_error;
+
+    argb.set_color(passed ? proxy::Argb::Colors::green : proxy::Argb::Colors::red);
+
+    TestCore::loop([]() { });
+
+    return 0;
+}
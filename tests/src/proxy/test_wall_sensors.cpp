@@ -7,8 +7,11 @@
 using namespace micras;  // NOLINT(google-build-using-namespace)
 
 // NOLINTBEGIN(*-avoid-c-arrays, cppcoreguidelines-avoid-non-const-global-variables)
-static volatile float test_reading[4];
-static volatile float test_adc_reading[4];
+static volatile float    test_reading[4];
+static volatile float    test_adc_reading[4];
+static volatile float    test_distance[4];
+static volatile uint32_t test_frame_number;
+static volatile uint32_t test_frame_timestamp;
 
 // NOLINTEND(*-avoid-c-arrays, cppcoreguidelines-avoid-non-const-global-variables)
 
@@ -25,8 +28,12 @@ int main(int argc, char* argv[]) {
         for (uint8_t i = 0; i < 4; i++) {
             test_reading[i] = wall_sensors.get_reading(i);
             test_adc_reading[i] = wall_sensors.get_adc_reading(i);
+            test_distance[i] = wall_sensors.get_distance(i);
         }
 
+        test_frame_number = wall_sensors.get_frame_number();
+        test_frame_timestamp = wall_sensors.get_frame_timestamp();
+
         for (uint8_t i = 0; i < 2; i++) {
             proxy::Argb::Color color{};
             color.red = wall_sensors.get_wall(3 - 3 * i) ? 255 : 0;